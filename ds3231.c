@@ -32,10 +32,30 @@ static ds3231_err_t ds3231_bus_write_data(ds3231_t const* ds3231,
     assert(ds3231);
 
     if (ds3231->interface.bus_write_data) {
-        return ds3231->interface.bus_write_data(ds3231->interface.bus_user,
-                                                write_address,
-                                                write_data,
-                                                write_size);
+        ds3231_err_t err = DS3231_ERR_OK;
+        uint8_t attempt = 0U;
+
+        do {
+#ifdef DS3231_INSTRUMENTATION
+            uint32_t start_ticks = ds3231_stats_get_ticks(ds3231->config.stats);
+#endif
+
+            err = ds3231->interface.bus_write_data(ds3231->interface.bus_user,
+                                                   write_address,
+                                                   write_data,
+                                                   write_size);
+
+#ifdef DS3231_INSTRUMENTATION
+            ds3231_stats_record(ds3231->config.stats,
+                                write_address,
+                                true,
+                                write_size,
+                                err != DS3231_ERR_OK,
+                                start_ticks);
+#endif
+        } while (err != DS3231_ERR_OK && attempt++ < ds3231->config.retries);
+
+        return err;
     }
 
     return DS3231_ERR_NULL;
@@ -49,18 +69,337 @@ static ds3231_err_t ds3231_bus_read_data(ds3231_t const* ds3231,
     assert(ds3231);
 
     if (ds3231->interface.bus_read_data) {
-        return ds3231->interface.bus_read_data(ds3231->interface.bus_user,
-                                               read_address,
-                                               read_data,
-                                               read_size);
+        ds3231_err_t err = DS3231_ERR_OK;
+        uint8_t attempt = 0U;
+
+        do {
+#ifdef DS3231_INSTRUMENTATION
+            uint32_t start_ticks = ds3231_stats_get_ticks(ds3231->config.stats);
+#endif
+
+            err = ds3231->interface.bus_read_data(ds3231->interface.bus_user,
+                                                  read_address,
+                                                  read_data,
+                                                  read_size);
+
+#ifdef DS3231_INSTRUMENTATION
+            ds3231_stats_record(ds3231->config.stats,
+                                read_address,
+                                false,
+                                read_size,
+                                err != DS3231_ERR_OK,
+                                start_ticks);
+#endif
+        } while (err != DS3231_ERR_OK && attempt++ < ds3231->config.retries);
+
+        return err;
     }
 
     return DS3231_ERR_NULL;
 }
 
-ds3231_err_t ds3231_initialize(ds3231_t* ds3231,
-                               ds3231_config_t const* config,
-                               ds3231_interface_t const* interface)
+static uint8_t ds3231_bin_to_bcd(uint8_t bin)
+{
+    return (uint8_t)(((bin / 10U) << 4U) | (bin % 10U));
+}
+
+static uint8_t ds3231_bcd_to_bin(uint8_t bcd)
+{
+    return (uint8_t)(bcd - 6U * (bcd >> 4U));
+}
+
+uint16_t ds3231_get_base_year(ds3231_t const* ds3231)
+{
+    assert(ds3231);
+
+    uint32_t base_century = ds3231->config.base_century ? ds3231->config.base_century
+                                                        : DS3231_BASE_CENTURY_DEFAULT;
+
+    return (uint16_t)(base_century * 100U);
+}
+
+static bool ds3231_is_leap_year(ds3231_t const* ds3231, ds3231_time_t const* time)
+{
+    assert(ds3231 && time);
+
+    uint32_t year = ds3231_get_base_year(ds3231) + time->century * 100U + time->year;
+
+    return (year % 4U == 0U) && (year % 100U != 0U || year % 400U == 0U);
+}
+
+// bit 5 is the pm flag in 12h mode and the twenty hour digit in 24h mode
+uint8_t ds3231_hour_data_to_hour(uint8_t data)
+{
+    uint32_t sys_12_n24 = (data >> 6U) & 0x01U;
+    uint32_t hour = ((data >> 4U) & (0x03U >> sys_12_n24)) * 10U + (data & 0x0FU);
+    uint32_t pm = (data >> 5U) & sys_12_n24;
+
+    return (uint8_t)(hour - 12U * (sys_12_n24 & (hour == 12U)) + 12U * pm);
+}
+
+uint8_t ds3231_hour_to_hour_data(uint8_t hour, bool sys_12_n24)
+{
+    uint32_t pm = sys_12_n24 & (hour >= 12U);
+    uint32_t hour_12 = hour - 12U * pm;
+
+    hour_12 += 12U * (sys_12_n24 & (hour_12 == 0U));
+
+    return (uint8_t)(((uint32_t)sys_12_n24 << 6U) | (pm << 5U) |
+                     ds3231_bin_to_bcd((uint8_t)hour_12));
+}
+
+// data holds the seconds up to year registers, as read in one burst
+void ds3231_time_data_to_time(uint8_t const* data, ds3231_time_t* time)
+{
+    assert(data && time);
+
+    time->second = ds3231_bcd_to_bin(data[0] & 0x7FU);
+    time->minute = ds3231_bcd_to_bin(data[1] & 0x7FU);
+    time->hour = ds3231_hour_data_to_hour(data[2]);
+    time->day = data[3] & 0x07U;
+    time->date = ds3231_bcd_to_bin(data[4] & 0x3FU);
+    time->month = ds3231_bcd_to_bin(data[5] & 0x1FU);
+    time->century = (data[5] >> 7U) & 0x01U;
+    time->year = ds3231_bcd_to_bin(data[6]);
+}
+
+void ds3231_time_to_time_data(ds3231_time_t const* time, bool sys_12_n24, uint8_t* data)
+{
+    assert(time && data);
+
+    data[0] = ds3231_bin_to_bcd(time->second);
+    data[1] = ds3231_bin_to_bcd(time->minute);
+    data[2] = ds3231_hour_to_hour_data(time->hour, sys_12_n24);
+    data[3] = time->day & 0x07U;
+    data[4] = ds3231_bin_to_bcd(time->date);
+    data[5] = (uint8_t)(((time->century & 0x01U) << 7U) | ds3231_bin_to_bcd(time->month));
+    data[6] = ds3231_bin_to_bcd(time->year);
+}
+
+// a zeroed config keeps the power-on state, intcn set and the rate select left alone,
+// alarm enables kept from the device are written back as read and never force a write
+static uint8_t ds3231_config_to_control_data(ds3231_config_t const* config, uint8_t control)
+{
+    assert(config);
+
+    uint8_t data = {};
+    uint8_t rate_select = (uint8_t)(config->sqw_on_int ? config->rate_select : control >> 3U);
+    uint8_t alarm_enables = (uint8_t)(((config->a2ie & 0x01U) << 1U) | (config->a1ie & 0x01U));
+
+    if (config->keep_alarm_enables) {
+        alarm_enables = control & 0x03U;
+    }
+
+    data |= (config->bbsqw & 0x01U) << 6U;
+    data |= (rate_select & 0x03U) << 3U;
+    data |= (!config->sqw_on_int & 0x01U) << 2U;
+    data |= alarm_enables;
+
+    return data;
+}
+
+// time registers up to alarm2 hour, the hour mode covers the time hour and both alarm hours
+#define DS3231_HOUR_STATE_SIZE (DS3231_REG_ADDR_ALARM2_HOUR - DS3231_REG_ADDR_SECOND + 1)
+
+// bus clocks of a burst read, address write, register, address read and data at 9 clocks each
+#define DS3231_READ_CLOCKS(size) (9UL * ((size) + 3UL))
+
+// reads size registers from seconds on, the hour is rewritten on its own after this burst,
+// so wait out 59:59 instead of letting the device roll the hour over under the write,
+// for about a second, a stopped oscillator then fails instead of holding the caller
+static ds3231_err_t ds3231_read_hour_state(ds3231_t const* ds3231,
+                                           uint8_t* state,
+                                           size_t size,
+                                           bool sys_12_n24)
+{
+    assert(ds3231 && state && size >= DS3231_HOUR_STATE_SIZE);
+
+    size_t polls = DS3231_BUS_FREQUENCY / DS3231_READ_CLOCKS(size) + 1UL;
+
+    for (size_t poll = 0UL; poll < polls; ++poll) {
+        ds3231_err_t err = ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_SECOND, state, size);
+        if (err != DS3231_ERR_OK) {
+            return err;
+        }
+
+        if (state[DS3231_REG_ADDR_MINUTE] != 0x59U ||
+            (state[DS3231_REG_ADDR_SECOND] & 0x7FU) != 0x59U) {
+            return DS3231_ERR_OK;
+        }
+
+        // nothing to wait for when the hour already is in the requested mode
+        uint8_t hour = state[DS3231_REG_ADDR_HOUR];
+
+        if (ds3231_hour_to_hour_data(ds3231_hour_data_to_hour(hour), sys_12_n24) == hour) {
+            return DS3231_ERR_OK;
+        }
+    }
+
+    return DS3231_ERR_FAIL;
+}
+
+static uint8_t ds3231_alarm_hour_data_to_mode(uint8_t data, bool sys_12_n24)
+{
+    return (uint8_t)((data & (0x01U << 7U)) |
+                     ds3231_hour_to_hour_data(ds3231_hour_data_to_hour(data & 0x7FU), sys_12_n24));
+}
+
+// converts the time hour and both alarm hours of a state read by ds3231_read_hour_state,
+// changed is optional
+static ds3231_err_t ds3231_write_hour_state(ds3231_t const* ds3231,
+                                            uint8_t* state,
+                                            bool sys_12_n24,
+                                            bool* changed)
+{
+    assert(ds3231 && state);
+
+    uint8_t* hour = &state[DS3231_REG_ADDR_HOUR];
+    uint8_t* alarm1_hour = &state[DS3231_REG_ADDR_ALARM1_HOUR];
+    uint8_t* alarm2_hour = &state[DS3231_REG_ADDR_ALARM2_HOUR];
+
+    uint8_t hour_data = ds3231_hour_to_hour_data(ds3231_hour_data_to_hour(*hour), sys_12_n24);
+    uint8_t alarm1_hour_data = ds3231_alarm_hour_data_to_mode(*alarm1_hour, sys_12_n24);
+    uint8_t alarm2_hour_data = ds3231_alarm_hour_data_to_mode(*alarm2_hour, sys_12_n24);
+
+    ds3231_err_t err = DS3231_ERR_OK;
+    bool is_changed = false;
+
+    if (hour_data != *hour) {
+        is_changed = true;
+        *hour = hour_data;
+        err |= ds3231_bus_write_data(ds3231, DS3231_REG_ADDR_HOUR, hour, sizeof(*hour));
+    }
+
+    if (alarm1_hour_data != *alarm1_hour || alarm2_hour_data != *alarm2_hour) {
+        is_changed = true;
+        *alarm1_hour = alarm1_hour_data;
+        *alarm2_hour = alarm2_hour_data;
+        err |= ds3231_bus_write_data(ds3231,
+                                     DS3231_REG_ADDR_ALARM1_HOUR,
+                                     alarm1_hour,
+                                     DS3231_REG_ADDR_ALARM2_HOUR - DS3231_REG_ADDR_ALARM1_HOUR + 1);
+    }
+
+    if (changed) {
+        *changed = is_changed;
+    }
+
+    if (!ds3231->config.validate || !is_changed || err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    uint8_t readback[DS3231_REG_ADDR_ALARM2_HOUR - DS3231_REG_ADDR_HOUR + 1] = {};
+
+    err = ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_HOUR, readback, sizeof(readback));
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    // the time keeps running, so only the mode bit is compared for the time hour
+    uint8_t mode = (uint8_t)((sys_12_n24 & 0x01U) << 6U);
+
+    if ((readback[0] & (0x01U << 6U)) != mode ||
+        readback[DS3231_REG_ADDR_ALARM1_HOUR - DS3231_REG_ADDR_HOUR] != *alarm1_hour ||
+        readback[DS3231_REG_ADDR_ALARM2_HOUR - DS3231_REG_ADDR_HOUR] != *alarm2_hour) {
+        return DS3231_ERR_FAIL;
+    }
+
+    return DS3231_ERR_OK;
+}
+
+// registers touched by the configuration, from control up to aging offset
+#define DS3231_STATUS_FLAGS ((0x01U << 7U) | (0x01U << 1U) | 0x01U)
+#define DS3231_CONFIG_STATE_SIZE (DS3231_REG_ADDR_AGING_OFFSET - DS3231_REG_ADDR_CONTROL + 1)
+#define DS3231_CONFIG_STATE_INDEX(address) ((address) - DS3231_REG_ADDR_CONTROL)
+
+static ds3231_err_t ds3231_read_config_state(ds3231_t const* ds3231, uint8_t* state)
+{
+    assert(ds3231 && state);
+
+    return ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_CONTROL, state, DS3231_CONFIG_STATE_SIZE);
+}
+
+// changed is optional
+static ds3231_err_t ds3231_write_config_state(ds3231_t const* ds3231,
+                                              uint8_t const* state,
+                                              bool clear_flags,
+                                              bool* changed)
+{
+    assert(ds3231 && state);
+
+    ds3231_config_t const* config = &ds3231->config;
+
+    uint8_t control = state[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_CONTROL)];
+    uint8_t status = state[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_STATUS)];
+    uint8_t aging_offset = state[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_AGING_OFFSET)];
+
+    // osf, a2f and a1f clear on a written 0, so they are written as 1 unless cleared on purpose,
+    // a flag raised between the read and the write then survives it
+    uint8_t flags = clear_flags ? 0U : DS3231_STATUS_FLAGS;
+
+    // conv self clears and is not part of the configuration, eosc must stay cleared
+    uint8_t data[3] = {};
+    uint8_t current[3] = {
+        (uint8_t)(control & ~(0x01U << 5U)),
+        (uint8_t)(status | flags),
+        aging_offset,
+    };
+
+    data[0] = ds3231_config_to_control_data(config, control);
+    data[1] = (uint8_t)((status & ~((0x01U << 3U) | DS3231_STATUS_FLAGS)) |
+                        ((!config->disable_32khz & 0x01U) << 3U) | flags);
+    data[2] = (uint8_t)config->aging_offset;
+
+    ds3231_err_t err = DS3231_ERR_OK;
+
+    // control, status and aging offset are adjacent, write only the span that differs
+    size_t first = 0UL;
+    size_t last = sizeof(data);
+
+    while (first < last && data[first] == current[first]) {
+        ++first;
+    }
+    while (last > first && data[last - 1UL] == current[last - 1UL]) {
+        --last;
+    }
+
+    if (first < last) {
+        err |= ds3231_bus_write_data(ds3231,
+                                     (uint8_t)(DS3231_REG_ADDR_CONTROL + first),
+                                     &data[first],
+                                     last - first);
+    }
+
+    if (changed) {
+        *changed = first < last;
+    }
+
+    if (!config->validate || first == last || err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    uint8_t readback[DS3231_CONFIG_STATE_SIZE] = {};
+
+    err = ds3231_read_config_state(ds3231, readback);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    // status flags may be raised by the device at any time, so only en32khz is compared
+    if ((readback[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_CONTROL)] & ~(0x01U << 5U)) !=
+            data[0] ||
+        (readback[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_STATUS)] & (0x01U << 3U)) !=
+            (data[1] & (0x01U << 3U)) ||
+        readback[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_AGING_OFFSET)] != data[2]) {
+        return DS3231_ERR_FAIL;
+    }
+
+    return DS3231_ERR_OK;
+}
+
+static ds3231_err_t ds3231_setup(ds3231_t* ds3231,
+                                 ds3231_config_t const* config,
+                                 ds3231_interface_t const* interface)
 {
     assert(ds3231 && config && interface);
 
@@ -71,6 +410,31 @@ ds3231_err_t ds3231_initialize(ds3231_t* ds3231,
     return ds3231_bus_initialize(ds3231);
 }
 
+ds3231_err_t ds3231_initialize(ds3231_t* ds3231,
+                               ds3231_config_t const* config,
+                               ds3231_interface_t const* interface)
+{
+    assert(ds3231 && config && interface);
+
+    ds3231_err_t err = ds3231_setup(ds3231, config, interface);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    // time and alarm hours for the hour mode plus the configuration, in one burst
+    uint8_t state[DS3231_REG_ADDR_AGING_OFFSET + 1] = {};
+
+    err = ds3231_read_hour_state(ds3231, state, sizeof(state), config->sys_12_n24);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    err = ds3231_write_hour_state(ds3231, state, config->sys_12_n24, NULL);
+    err |= ds3231_write_config_state(ds3231, &state[DS3231_REG_ADDR_CONTROL], false, NULL);
+
+    return err;
+}
+
 ds3231_err_t ds3231_deinitialize(ds3231_t* ds3231)
 {
     assert(ds3231);
@@ -82,6 +446,48 @@ ds3231_err_t ds3231_deinitialize(ds3231_t* ds3231)
     return err;
 }
 
+// the hour mode is trusted on a warm boot, ds3231_set_hour_mode converts the time and alarms
+ds3231_err_t ds3231_boot(ds3231_t* ds3231,
+                         ds3231_config_t const* config,
+                         ds3231_interface_t const* interface,
+                         ds3231_time_t const* time,
+                         ds3231_boot_t* boot)
+{
+    assert(ds3231 && config && interface && time && boot);
+
+    ds3231_err_t err = ds3231_setup(ds3231, config, interface);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    uint8_t state[DS3231_CONFIG_STATE_SIZE] = {};
+
+    err = ds3231_read_config_state(ds3231, state);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    if ((state[DS3231_CONFIG_STATE_INDEX(DS3231_REG_ADDR_STATUS)] & (0x01U << 7U)) == 0U) {
+        bool changed = false;
+
+        err = ds3231_write_config_state(ds3231, state, false, &changed);
+
+        *boot = changed ? DS3231_BOOT_RECONFIGURED : DS3231_BOOT_WARM;
+
+        return err;
+    }
+
+    // oscillator stopped, time is invalid and alarm flags are stale
+    *boot = DS3231_BOOT_COLD;
+
+    err = ds3231_set_time_data(ds3231, time);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    return ds3231_write_config_state(ds3231, state, true, NULL);
+}
+
 ds3231_err_t ds3231_get_temp_data_scaled(ds3231_t const* ds3231, float* scaled)
 {
     assert(ds3231 && scaled);
@@ -117,18 +523,209 @@ ds3231_err_t ds3231_get_time_data(ds3231_t const* ds3231, ds3231_time_t* time)
 {
     assert(ds3231 && time);
 
-    ds3231_err_t err = ds3231_get_century_data(ds3231, &time->century);
-    err |= ds3231_get_year_data(ds3231, &time->year);
-    err |= ds3231_get_month_data(ds3231, &time->month);
-    err |= ds3231_get_date_data(ds3231, &time->date);
-    err |= ds3231_get_day_data(ds3231, &time->day);
-    err |= ds3231_get_hour_data(ds3231, &time->hour);
-    err |= ds3231_get_minute_data(ds3231, &time->minute);
-    err |= ds3231_get_second_data(ds3231, &time->second);
+    // one burst, so no field can roll over between reads
+    uint8_t data[DS3231_REG_ADDR_YEAR - DS3231_REG_ADDR_SECOND + 1] = {};
+
+    ds3231_err_t err = ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_SECOND, data, sizeof(data));
+
+    ds3231_time_data_to_time(data, time);
+
+    // the device counts every year 00 as a leap year, so on a non leap century year it reaches
+    // feb 29, that day is mar 1 and is rewritten in place, once, costing under a second of phase
+    if (err == DS3231_ERR_OK && time->month == 2U && time->date == 29U &&
+        !ds3231_is_leap_year(ds3231, time)) {
+        time->month = 3U;
+        time->date = 1U;
+
+        ds3231_time_to_time_data(time, ds3231->config.sys_12_n24, data);
+
+        err = ds3231_bus_write_data(ds3231, DS3231_REG_ADDR_SECOND, data, sizeof(data));
+    }
 
     return err;
 }
 
+ds3231_err_t ds3231_set_time_data(ds3231_t const* ds3231, ds3231_time_t const* time)
+{
+    assert(ds3231 && time);
+
+    if (!ds3231_is_time_valid(ds3231, time)) {
+        return DS3231_ERR_FAIL;
+    }
+
+    uint8_t data[DS3231_REG_ADDR_YEAR - DS3231_REG_ADDR_SECOND + 1] = {};
+
+    ds3231_time_to_time_data(time, ds3231->config.sys_12_n24, data);
+
+    return ds3231_bus_write_data(ds3231, DS3231_REG_ADDR_SECOND, data, sizeof(data));
+}
+
+ds3231_err_t ds3231_get_full_year_data(ds3231_t const* ds3231, uint16_t* year)
+{
+    assert(ds3231 && year);
+
+    // century bit and year share one burst, so the 99 to 00 rollover cannot tear
+    uint8_t data[2] = {};
+
+    ds3231_err_t err =
+        ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_MONTH_CENTURY, data, sizeof(data));
+
+    *year = (uint16_t)(ds3231_get_base_year(ds3231) + ((data[0] >> 7U) & 0x01U) * 100U +
+                       ds3231_bcd_to_bin(data[1]));
+
+    return err;
+}
+
+ds3231_err_t ds3231_set_full_year_data(ds3231_t const* ds3231, uint16_t year)
+{
+    assert(ds3231);
+
+    uint32_t base_year = ds3231_get_base_year(ds3231);
+
+    if (year < base_year || year >= base_year + 200U) {
+        return DS3231_ERR_FAIL;
+    }
+
+    // the whole time is read so the date can be checked against the new year, a feb 29 stays
+    // only in a leap year
+    uint8_t data[DS3231_REG_ADDR_YEAR - DS3231_REG_ADDR_SECOND + 1] = {};
+
+    ds3231_err_t err = ds3231_bus_read_data(ds3231, DS3231_REG_ADDR_SECOND, data, sizeof(data));
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    uint32_t offset = year - base_year;
+    ds3231_time_t time = {};
+
+    ds3231_time_data_to_time(data, &time);
+    time.century = (uint8_t)(offset / 100U);
+    time.year = (uint8_t)(offset % 100U);
+
+    if (!ds3231_is_time_valid(ds3231, &time)) {
+        return DS3231_ERR_FAIL;
+    }
+
+    data[DS3231_REG_ADDR_MONTH_CENTURY] =
+        (uint8_t)((data[DS3231_REG_ADDR_MONTH_CENTURY] & 0x1FU) | (time.century << 7U));
+    data[DS3231_REG_ADDR_YEAR] = ds3231_bin_to_bcd(time.year);
+
+    // century bit and year still land in one burst
+    return ds3231_bus_write_data(ds3231,
+                                 DS3231_REG_ADDR_MONTH_CENTURY,
+                                 &data[DS3231_REG_ADDR_MONTH_CENTURY],
+                                 2UL);
+}
+
+bool ds3231_is_time_valid(ds3231_t const* ds3231, ds3231_time_t const* time)
+{
+    assert(ds3231 && time);
+
+    static uint8_t const month_days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    if (time->century > 1U || time->year > 99U || time->month < 1U || time->month > 12U ||
+        time->day < 1U || time->day > 7U || time->hour > 23U || time->minute > 59U ||
+        time->second > 59U) {
+        return false;
+    }
+
+    bool is_leap = ds3231_is_leap_year(ds3231, time);
+
+    return time->date >= 1U &&
+           time->date <= month_days[time->month - 1U] + (is_leap && time->month == 2U);
+}
+
+ds3231_err_t ds3231_set_alarm1_data(ds3231_t const* ds3231,
+                                    ds3231_alarm1_t alarm,
+                                    ds3231_time_t const* time)
+{
+    assert(ds3231 && time);
+
+    uint8_t data[4] = {};
+
+    data[0] = (uint8_t)(((alarm & 0x01U) << 7U) | ds3231_bin_to_bcd(time->second));
+    data[1] = (uint8_t)((((alarm >> 1U) & 0x01U) << 7U) | ds3231_bin_to_bcd(time->minute));
+    data[2] = (uint8_t)((((alarm >> 2U) & 0x01U) << 7U) |
+                        ds3231_hour_to_hour_data(time->hour, ds3231->config.sys_12_n24));
+    data[3] = (uint8_t)((((alarm >> 3U) & 0x01U) << 7U) | ds3231_bin_to_bcd(time->date));
+
+    return ds3231_bus_write_data(ds3231, DS3231_REG_ADDR_ALARM1_SECOND, data, sizeof(data));
+}
+
+ds3231_err_t ds3231_set_alarm2_data(ds3231_t const* ds3231,
+                                    ds3231_alarm2_t alarm,
+                                    ds3231_time_t const* time)
+{
+    assert(ds3231 && time);
+
+    uint8_t data[3] = {};
+
+    data[0] = (uint8_t)(((alarm & 0x01U) << 7U) | ds3231_bin_to_bcd(time->minute));
+    data[1] = (uint8_t)((((alarm >> 1U) & 0x01U) << 7U) |
+                        ds3231_hour_to_hour_data(time->hour, ds3231->config.sys_12_n24));
+    data[2] = (uint8_t)((((alarm >> 2U) & 0x01U) << 7U) | ds3231_bin_to_bcd(time->date));
+
+    return ds3231_bus_write_data(ds3231, DS3231_REG_ADDR_ALARM2_MINUTE, data, sizeof(data));
+}
+
+// years before 1970 give negative timestamps, divisions below round towards minus infinity
+int64_t ds3231_time_to_timestamp(ds3231_time_t const* time, uint16_t base_year)
+{
+    assert(time);
+
+    // days from civil date, with march as the first month of the year
+    int64_t year = (int64_t)base_year + time->century * 100 + time->year - (time->month <= 2U);
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t year_of_era = (uint32_t)(year - era * 400);
+    uint32_t month_of_year = time->month + (time->month > 2U ? -3U : 9U);
+    uint32_t day_of_year = (153U * month_of_year + 2U) / 5U + time->date - 1U;
+    uint32_t day_of_era = year_of_era * 365U + year_of_era / 4U - year_of_era / 100U + day_of_year;
+    int64_t days = era * 146097 + (int64_t)day_of_era - 719468;
+
+    return days * 86400 + time->hour * 3600 + time->minute * 60 + time->second;
+}
+
+ds3231_err_t ds3231_timestamp_to_time(int64_t timestamp, uint16_t base_year, ds3231_time_t* time)
+{
+    assert(time);
+
+    int64_t days = timestamp / 86400;
+    int64_t seconds = timestamp % 86400;
+
+    if (seconds < 0) {
+        seconds += 86400;
+        --days;
+    }
+
+    // civil date from days, with march as the first month of the year
+    int64_t shifted = days + 719468;
+    int64_t era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+    uint32_t day_of_era = (uint32_t)(shifted - era * 146097);
+    uint32_t year_of_era =
+        (day_of_era - day_of_era / 1460U + day_of_era / 36524U - day_of_era / 146096U) / 365U;
+    uint32_t day_of_year =
+        day_of_era - (365U * year_of_era + year_of_era / 4U - year_of_era / 100U);
+    uint32_t month_of_year = (5U * day_of_year + 2U) / 153U;
+    uint32_t month = month_of_year + (month_of_year < 10U ? 3U : -9U);
+    int64_t year = era * 400 + year_of_era + (month <= 2U) - base_year;
+
+    // the device counts two centuries from the base year
+    if (year < 0 || year >= 200) {
+        return DS3231_ERR_FAIL;
+    }
+
+    time->century = (uint8_t)(year / 100);
+    time->year = (uint8_t)(year % 100);
+    time->month = (uint8_t)month;
+    time->date = (uint8_t)(day_of_year - (153U * month_of_year + 2U) / 5U + 1U);
+    time->day = (uint8_t)(((days + 3) % 7 + 7) % 7 + 1);
+    time->hour = (uint8_t)(seconds / 3600);
+    time->minute = (uint8_t)(seconds / 60 % 60);
+    time->second = (uint8_t)(seconds % 60);
+
+    return DS3231_ERR_OK;
+}
+
 ds3231_err_t ds3231_get_century_data(ds3231_t const* ds3231, uint8_t* century)
 {
     assert(ds3231 && century);
@@ -202,7 +799,55 @@ ds3231_err_t ds3231_get_hour_data(ds3231_t const* ds3231, uint8_t* hour)
 
     ds3231_err_t err = ds3231_get_hour_reg(ds3231, &reg);
 
-    *hour = reg.ten_hour * 10U + reg.hour;
+    *hour = ds3231_hour_data_to_hour((uint8_t)((reg.sys_12_n24 << 6U) | (reg.n_am_pm << 5U) |
+                                               (reg.ten_hour << 4U) | reg.hour));
+
+    return err;
+}
+
+ds3231_err_t ds3231_get_alarm1_hour_data(ds3231_t const* ds3231, uint8_t* hour)
+{
+    assert(ds3231 && hour);
+
+    ds3231_alarm1_hour_reg_t reg = {};
+
+    ds3231_err_t err = ds3231_get_alarm1_hour_reg(ds3231, &reg);
+
+    *hour = ds3231_hour_data_to_hour((uint8_t)((reg.sys_12_n24 << 6U) | (reg.n_am_pm << 5U) |
+                                               (reg.ten_hour << 4U) | reg.hour));
+
+    return err;
+}
+
+ds3231_err_t ds3231_get_alarm2_hour_data(ds3231_t const* ds3231, uint8_t* hour)
+{
+    assert(ds3231 && hour);
+
+    ds3231_alarm2_hour_reg_t reg = {};
+
+    ds3231_err_t err = ds3231_get_alarm2_hour_reg(ds3231, &reg);
+
+    *hour = ds3231_hour_data_to_hour((uint8_t)((reg.sys_12_n24 << 6U) | (reg.n_am_pm << 5U) |
+                                               (reg.ten_hour << 4U) | reg.hour));
+
+    return err;
+}
+
+ds3231_err_t ds3231_set_hour_mode(ds3231_t* ds3231, bool sys_12_n24)
+{
+    assert(ds3231);
+
+    uint8_t state[DS3231_HOUR_STATE_SIZE] = {};
+
+    ds3231_err_t err = ds3231_read_hour_state(ds3231, state, sizeof(state), sys_12_n24);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    err = ds3231_write_hour_state(ds3231, state, sys_12_n24, NULL);
+    if (err == DS3231_ERR_OK) {
+        ds3231->config.sys_12_n24 = sys_12_n24;
+    }
 
     return err;
 }
@@ -14,10 +14,37 @@ ds3231_err_t ds3231_initialize(ds3231_t* ds3231,
                                ds3231_interface_t const* interface);
 ds3231_err_t ds3231_deinitialize(ds3231_t* ds3231);
 
+ds3231_err_t ds3231_boot(ds3231_t* ds3231,
+                         ds3231_config_t const* config,
+                         ds3231_interface_t const* interface,
+                         ds3231_time_t const* time,
+                         ds3231_boot_t* boot);
+
 ds3231_err_t ds3231_get_temp_data_scaled(ds3231_t const* ds3231, float* scaled);
 ds3231_err_t ds3231_get_temp_data_raw(ds3231_t const* ds3231, int16_t* raw);
 
 ds3231_err_t ds3231_get_time_data(ds3231_t const* ds3231, ds3231_time_t* time);
+ds3231_err_t ds3231_set_time_data(ds3231_t const* ds3231, ds3231_time_t const* time);
+
+uint16_t ds3231_get_base_year(ds3231_t const* ds3231);
+ds3231_err_t ds3231_get_full_year_data(ds3231_t const* ds3231, uint16_t* year);
+ds3231_err_t ds3231_set_full_year_data(ds3231_t const* ds3231, uint16_t year);
+bool ds3231_is_time_valid(ds3231_t const* ds3231, ds3231_time_t const* time);
+
+ds3231_err_t ds3231_set_alarm1_data(ds3231_t const* ds3231,
+                                    ds3231_alarm1_t alarm,
+                                    ds3231_time_t const* time);
+ds3231_err_t ds3231_set_alarm2_data(ds3231_t const* ds3231,
+                                    ds3231_alarm2_t alarm,
+                                    ds3231_time_t const* time);
+
+uint8_t ds3231_hour_data_to_hour(uint8_t data);
+uint8_t ds3231_hour_to_hour_data(uint8_t hour, bool sys_12_n24);
+void ds3231_time_data_to_time(uint8_t const* data, ds3231_time_t* time);
+void ds3231_time_to_time_data(ds3231_time_t const* time, bool sys_12_n24, uint8_t* data);
+
+int64_t ds3231_time_to_timestamp(ds3231_time_t const* time, uint16_t base_year);
+ds3231_err_t ds3231_timestamp_to_time(int64_t timestamp, uint16_t base_year, ds3231_time_t* time);
 
 ds3231_err_t ds3231_get_century_data(ds3231_t const* ds3231, uint8_t* century);
 ds3231_err_t ds3231_get_year_data(ds3231_t const* ds3231, uint8_t* year);
@@ -25,6 +52,9 @@ ds3231_err_t ds3231_get_month_data(ds3231_t const* ds3231, uint8_t* month);
 ds3231_err_t ds3231_get_date_data(ds3231_t const* ds3231, uint8_t* date);
 ds3231_err_t ds3231_get_day_data(ds3231_t const* ds3231, uint8_t* day);
 ds3231_err_t ds3231_get_hour_data(ds3231_t const* ds3231, uint8_t* hour);
+ds3231_err_t ds3231_get_alarm1_hour_data(ds3231_t const* ds3231, uint8_t* hour);
+ds3231_err_t ds3231_get_alarm2_hour_data(ds3231_t const* ds3231, uint8_t* hour);
+ds3231_err_t ds3231_set_hour_mode(ds3231_t* ds3231, bool sys_12_n24);
 ds3231_err_t ds3231_get_minute_data(ds3231_t const* ds3231, uint8_t* minute);
 ds3231_err_t ds3231_get_second_data(ds3231_t const* ds3231, uint8_t* second);
 
@@ -0,0 +1,144 @@
+#include "ds3231_codec.h"
+#include <assert.h>
+#include <string.h>
+
+// the arrays are plain runs of register bytes, records packed back to back
+static_assert(sizeof(ds3231_time_raw_t) == DS3231_TIME_RAW_SIZE);
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && !defined(DS3231_CODEC_SCALAR)
+#define DS3231_CODEC_SWAR 1
+#else
+#define DS3231_CODEC_SWAR 0
+#endif
+
+#if DS3231_CODEC_SWAR
+
+// one raw record per 64-bit word, one register per byte lane, hour lane handled separately
+#define DS3231_CODEC_LANE_MASK 0x00FF1F3F07007F7FULL
+#define DS3231_CODEC_NIBBLE_MASK 0x0F0F0F0F0F0F0F0FULL
+#define DS3231_CODEC_EVEN_LANES 0x00FF00FF00FF00FFULL
+#define DS3231_CODEC_EVEN_NIBBLES 0x000F000F000F000FULL
+
+static_assert(sizeof(ds3231_time_t) == sizeof(uint64_t));
+
+static void ds3231_decode_time(uint8_t const* data, ds3231_time_t* time, bool is_last)
+{
+    assert(data && time);
+
+    // a full word from any but the last record ends inside the next one, the last is padded
+    uint64_t word = {};
+
+    if (is_last) {
+        uint8_t padded[sizeof(word)] = {};
+        memcpy(padded, data, DS3231_TIME_RAW_SIZE);
+        memcpy(&word, padded, sizeof(word));
+    } else {
+        memcpy(&word, data, sizeof(word));
+    }
+
+    uint64_t bcd = word & DS3231_CODEC_LANE_MASK;
+
+    // per lane 16 * tens + units - 6 * tens, lanes never borrow from each other
+    uint64_t bin = bcd - 6U * ((bcd >> 4U) & DS3231_CODEC_NIBBLE_MASK);
+
+    // ds3231_time_t holds the same fields in reverse register order, led by the century
+    bin = __builtin_bswap64(bin);
+    bin |= (word >> 47U) & 0x01U;
+    bin |= (uint64_t)ds3231_hour_data_to_hour((uint8_t)(word >> 16U)) << 40U;
+
+    memcpy(time, &bin, sizeof(bin));
+}
+
+static uint64_t ds3231_bin_to_bcd_lanes(uint64_t lanes)
+{
+    // widen to 16-bit lanes so that tens = lane * 103 >> 10 fits, then lane + 6 * tens
+    uint64_t even = lanes & DS3231_CODEC_EVEN_LANES;
+    uint64_t odd = (lanes >> 8U) & DS3231_CODEC_EVEN_LANES;
+
+    even += 6U * (((even * 103U) >> 10U) & DS3231_CODEC_EVEN_NIBBLES);
+    odd += 6U * (((odd * 103U) >> 10U) & DS3231_CODEC_EVEN_NIBBLES);
+
+    return even | (odd << 8U);
+}
+
+static void ds3231_encode_time(ds3231_time_t const* time, ds3231_time_raw_t* raw, bool sys_12_n24)
+{
+    assert(time && raw);
+
+    uint64_t bin = {};
+    memcpy(&bin, time, sizeof(bin));
+
+    bin = __builtin_bswap64(bin);
+
+    uint64_t word = ds3231_bin_to_bcd_lanes(bin) & DS3231_CODEC_LANE_MASK;
+
+    word |= (uint64_t)ds3231_hour_to_hour_data(time->hour, sys_12_n24) << 16U;
+    word |= (uint64_t)(time->century & 0x01U) << 47U;
+
+    memcpy(raw->data, &word, sizeof(raw->data));
+}
+
+#else
+
+// the scalar path is the register codec of the getters and setters
+static void ds3231_decode_time(uint8_t const* data, ds3231_time_t* time, bool is_last)
+{
+    assert(data && time);
+
+    (void)is_last;
+
+    ds3231_time_data_to_time(data, time);
+}
+
+static void ds3231_encode_time(ds3231_time_t const* time, ds3231_time_raw_t* raw, bool sys_12_n24)
+{
+    assert(time && raw);
+
+    ds3231_time_to_time_data(time, sys_12_n24, raw->data);
+}
+
+#endif
+
+void ds3231_decode_time_array(ds3231_time_raw_t const* raws, ds3231_time_t* times, size_t count)
+{
+    assert((raws && times) || !count);
+
+    // the wide loads index the whole array, never a single record
+    uint8_t const* data = (uint8_t const*)raws;
+
+    for (size_t index = 0UL; index < count; ++index) {
+        ds3231_decode_time(data + index * DS3231_TIME_RAW_SIZE,
+                           &times[index],
+                           index + 1UL == count);
+    }
+}
+
+void ds3231_decode_timestamp_array(ds3231_time_raw_t const* raws,
+                                   int64_t* timestamps,
+                                   size_t count,
+                                   uint16_t base_year)
+{
+    assert((raws && timestamps) || !count);
+
+    uint8_t const* data = (uint8_t const*)raws;
+
+    for (size_t index = 0UL; index < count; ++index) {
+        ds3231_time_t time = {};
+        ds3231_decode_time(data + index * DS3231_TIME_RAW_SIZE, &time, index + 1UL == count);
+
+        timestamps[index] = ds3231_time_to_timestamp(&time, base_year);
+    }
+}
+
+void ds3231_encode_time_array(ds3231_time_t const* times,
+                              ds3231_time_raw_t* raws,
+                              size_t count,
+                              bool sys_12_n24)
+{
+    assert((times && raws) || !count);
+
+    for (size_t index = 0UL; index < count; ++index) {
+        ds3231_encode_time(&times[index], &raws[index], sys_12_n24);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef DS3231_DS3231_CODEC_H
+#define DS3231_DS3231_CODEC_H
+
+#include "ds3231.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS3231_TIME_RAW_SIZE 7UL
+
+typedef struct {
+    uint8_t data[DS3231_TIME_RAW_SIZE];
+} ds3231_time_raw_t;
+
+void ds3231_decode_time_array(ds3231_time_raw_t const* raws,
+                              ds3231_time_t* times,
+                              size_t count);
+void ds3231_decode_timestamp_array(ds3231_time_raw_t const* raws,
+                                   int64_t* timestamps,
+                                   size_t count,
+                                   uint16_t base_year);
+void ds3231_encode_time_array(ds3231_time_t const* times,
+                              ds3231_time_raw_t* raws,
+                              size_t count,
+                              bool sys_12_n24);
+
+#endif // DS3231_DS3231_CODEC_H
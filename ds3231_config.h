@@ -2,11 +2,22 @@
 #define DS3231_DS3231_CONFIG_H
 
 #include "ds3231_registers.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#ifdef DS3231_INSTRUMENTATION
+#include "ds3231_stats.h"
+#endif
+
 #define DS3231_SLAVE_ADDRESS 0b1101000
 #define DS3231_TEMP_SCALE 0.25F
+#define DS3231_BASE_CENTURY_DEFAULT 20U
+
+// bus clock in hz, waits on the device are sized from it to last about a second
+#ifndef DS3231_BUS_FREQUENCY
+#define DS3231_BUS_FREQUENCY 400000UL
+#endif
 
 typedef struct {
     uint8_t century;
@@ -73,7 +84,28 @@ typedef enum {
     DS3231_RATE_SELECT_8KHZ192 = 0b11,
 } ds3231_rate_select_t;
 
+typedef enum {
+    DS3231_BOOT_WARM,
+    DS3231_BOOT_RECONFIGURED,
+    DS3231_BOOT_COLD,
+} ds3231_boot_t;
+
 typedef struct {
+    ds3231_rate_select_t rate_select;
+    bool sqw_on_int;
+    bool bbsqw;
+    bool a1ie;
+    bool a2ie;
+    bool keep_alarm_enables; // a1ie and a2ie left to the device, set when the scheduler owns them
+    bool disable_32khz;
+    int8_t aging_offset;
+    bool sys_12_n24;
+    bool validate;
+    uint8_t retries;
+    uint8_t base_century;
+#ifdef DS3231_INSTRUMENTATION
+    ds3231_stats_t* stats;
+#endif
 } ds3231_config_t;
 
 typedef struct {
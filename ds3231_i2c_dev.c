@@ -0,0 +1,114 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds3231_i2c_dev.h"
+#include <assert.h>
+#include <fcntl.h>
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+void ds3231_i2c_dev_get_interface(ds3231_i2c_dev_t* i2c_dev, ds3231_interface_t* interface)
+{
+    assert(i2c_dev && interface);
+
+    interface->bus_user = i2c_dev;
+    interface->bus_initialize = ds3231_i2c_dev_bus_initialize;
+    interface->bus_deinitialize = ds3231_i2c_dev_bus_deinitialize;
+    interface->bus_write_data = ds3231_i2c_dev_bus_write_data;
+    interface->bus_read_data = ds3231_i2c_dev_bus_read_data;
+}
+
+ds3231_err_t ds3231_i2c_dev_bus_initialize(void* user)
+{
+    assert(user);
+
+    ds3231_i2c_dev_t* i2c_dev = user;
+
+    i2c_dev->fd = open(i2c_dev->path, O_RDWR | O_CLOEXEC);
+
+    return i2c_dev->fd < 0 ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_i2c_dev_bus_deinitialize(void* user)
+{
+    assert(user);
+
+    ds3231_i2c_dev_t* i2c_dev = user;
+
+    int ret = close(i2c_dev->fd);
+
+    i2c_dev->fd = -1;
+
+    return ret < 0 ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_i2c_dev_bus_write_data(void* user,
+                                           uint8_t write_address,
+                                           uint8_t const* write_data,
+                                           size_t write_size)
+{
+    assert(user && write_data);
+
+    ds3231_i2c_dev_t* i2c_dev = user;
+
+    if (write_size > DS3231_I2C_DEV_WRITE_SIZE_MAX) {
+        return DS3231_ERR_FAIL;
+    }
+
+    // register address and payload go out in a single message
+    uint8_t buffer[1UL + DS3231_I2C_DEV_WRITE_SIZE_MAX] = {};
+
+    buffer[0] = write_address;
+    memcpy(&buffer[1], write_data, write_size);
+
+    struct i2c_msg message = {
+        .addr = i2c_dev->address,
+        .flags = 0U,
+        .len = (uint16_t)(1UL + write_size),
+        .buf = buffer,
+    };
+    struct i2c_rdwr_ioctl_data transfer = {
+        .msgs = &message,
+        .nmsgs = 1U,
+    };
+
+    return ioctl(i2c_dev->fd, I2C_RDWR, &transfer) < 0 ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_i2c_dev_bus_read_data(void* user,
+                                          uint8_t read_address,
+                                          uint8_t* read_data,
+                                          size_t read_size)
+{
+    assert(user && read_data);
+
+    ds3231_i2c_dev_t* i2c_dev = user;
+
+    if (read_size > UINT16_MAX) {
+        return DS3231_ERR_FAIL;
+    }
+
+    // address write and data read joined by a repeated start, one syscall per burst
+    struct i2c_msg messages[2] = {
+        {
+            .addr = i2c_dev->address,
+            .flags = 0U,
+            .len = sizeof(read_address),
+            .buf = &read_address,
+        },
+        {
+            .addr = i2c_dev->address,
+            .flags = I2C_M_RD,
+            .len = (uint16_t)read_size,
+            .buf = read_data,
+        },
+    };
+    struct i2c_rdwr_ioctl_data transfer = {
+        .msgs = messages,
+        .nmsgs = 2U,
+    };
+
+    return ioctl(i2c_dev->fd, I2C_RDWR, &transfer) < 0 ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
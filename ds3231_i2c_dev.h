@@ -0,0 +1,29 @@
+#ifndef DS3231_DS3231_I2C_DEV_H
+#define DS3231_DS3231_I2C_DEV_H
+
+#include "ds3231_config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS3231_I2C_DEV_WRITE_SIZE_MAX 19UL
+
+typedef struct {
+    char const* path;
+    uint16_t address;
+    int fd;
+} ds3231_i2c_dev_t;
+
+void ds3231_i2c_dev_get_interface(ds3231_i2c_dev_t* i2c_dev, ds3231_interface_t* interface);
+
+ds3231_err_t ds3231_i2c_dev_bus_initialize(void* user);
+ds3231_err_t ds3231_i2c_dev_bus_deinitialize(void* user);
+ds3231_err_t ds3231_i2c_dev_bus_write_data(void* user,
+                                           uint8_t write_address,
+                                           uint8_t const* write_data,
+                                           size_t write_size);
+ds3231_err_t ds3231_i2c_dev_bus_read_data(void* user,
+                                          uint8_t read_address,
+                                          uint8_t* read_data,
+                                          size_t read_size);
+
+#endif // DS3231_DS3231_I2C_DEV_H
@@ -0,0 +1,206 @@
+#include "ds3231_scheduler.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static void ds3231_scheduler_dispatch_jobs(ds3231_scheduler_t* scheduler, int64_t now)
+{
+    assert(scheduler);
+
+    for (size_t index = 0UL; index < scheduler->jobs_count; ++index) {
+        ds3231_job_t* job = &scheduler->jobs[index];
+
+        if (job->due > now) {
+            continue;
+        }
+
+        // periodic jobs skip the periods missed while asleep, one-shot jobs retire
+        if (job->period) {
+            job->due += ((now - job->due) / job->period + 1) * job->period;
+        } else {
+            job->due = DS3231_JOB_DUE_NEVER;
+        }
+
+        if (job->job_callback) {
+            job->job_callback(job->job_user);
+        }
+    }
+}
+
+static int64_t ds3231_scheduler_get_next_due(ds3231_scheduler_t const* scheduler)
+{
+    assert(scheduler);
+
+    int64_t next_due = DS3231_JOB_DUE_NEVER;
+
+    for (size_t index = 0UL; index < scheduler->jobs_count; ++index) {
+        if (scheduler->jobs[index].due < next_due) {
+            next_due = scheduler->jobs[index].due;
+        }
+    }
+
+    return next_due;
+}
+
+// a date match fires on the first matching date, so events more than a month ahead
+// wake the node early, find nothing due and re-arm for the same event
+static ds3231_alarm1_t ds3231_scheduler_get_alarm1(int64_t delta)
+{
+    if (delta < 60) {
+        return DS3231_ALARM1_SEC_MATCH;
+    } else if (delta < 3600) {
+        return DS3231_ALARM1_MIN_SEC_MATCH;
+    } else if (delta < 86400) {
+        return DS3231_ALARM1_HR_MIN_SEC_MATCH;
+    }
+
+    return DS3231_ALARM1_DATE_HR_MIN_SEC_MATCH;
+}
+
+static ds3231_alarm2_t ds3231_scheduler_get_alarm2(int64_t delta)
+{
+    if (delta < 3600) {
+        return DS3231_ALARM2_MIN_MATCH;
+    } else if (delta < 86400) {
+        return DS3231_ALARM2_HR_MIN_MATCH;
+    }
+
+    return DS3231_ALARM2_DATE_HR_MIN_MATCH;
+}
+
+static ds3231_err_t ds3231_scheduler_program_alarm(ds3231_scheduler_t const* scheduler,
+                                                   int64_t now,
+                                                   int64_t* alarm_due)
+{
+    assert(scheduler && alarm_due);
+
+    ds3231_control_reg_t reg = {};
+
+    ds3231_err_t err = ds3231_get_control_reg(scheduler->ds3231, &reg);
+
+    int64_t next_due = ds3231_scheduler_get_next_due(scheduler);
+
+    *alarm_due = DS3231_JOB_DUE_NEVER;
+
+    if (next_due == DS3231_JOB_DUE_NEVER) {
+        reg.a1ie = 0U;
+        reg.a2ie = 0U;
+
+        return err | ds3231_set_control_reg(scheduler->ds3231, &reg);
+    }
+
+    if (next_due <= now) {
+        next_due = now + 1;
+    }
+
+    // a job beyond the two centuries the device counts can not be programmed
+    ds3231_time_t time = {};
+    err |= ds3231_timestamp_to_time(next_due, ds3231_get_base_year(scheduler->ds3231), &time);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    // minute aligned events fit the coarser alarm2, anything else needs alarm1
+    bool use_alarm2 = (next_due % 60) == 0;
+
+    if (use_alarm2) {
+        err |= ds3231_set_alarm2_data(scheduler->ds3231,
+                                      ds3231_scheduler_get_alarm2(next_due - now),
+                                      &time);
+    } else {
+        err |= ds3231_set_alarm1_data(scheduler->ds3231,
+                                      ds3231_scheduler_get_alarm1(next_due - now),
+                                      &time);
+    }
+
+    *alarm_due = next_due;
+
+    reg.intcn = 1U;
+    reg.a1ie = !use_alarm2;
+    reg.a2ie = use_alarm2;
+
+    return err | ds3231_set_control_reg(scheduler->ds3231, &reg);
+}
+
+ds3231_err_t ds3231_scheduler_initialize(ds3231_scheduler_t* scheduler,
+                                         ds3231_t const* ds3231,
+                                         ds3231_job_t* jobs,
+                                         size_t jobs_count)
+{
+    assert(scheduler && ds3231 && (jobs || !jobs_count));
+
+    memset(scheduler, 0, sizeof(*scheduler));
+
+    scheduler->ds3231 = ds3231;
+    scheduler->jobs = jobs;
+    scheduler->jobs_count = jobs_count;
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_scheduler_deinitialize(ds3231_scheduler_t* scheduler)
+{
+    assert(scheduler);
+
+    memset(scheduler, 0, sizeof(*scheduler));
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_scheduler_run(ds3231_scheduler_t* scheduler)
+{
+    assert(scheduler);
+
+    int64_t alarm_due = INT64_MIN;
+
+    // callbacks and the alarm write take time, so keep going until the alarm is ahead of the clock
+    do {
+        ds3231_time_t time = {};
+
+        ds3231_err_t err = ds3231_get_time_data(scheduler->ds3231, &time);
+        if (err != DS3231_ERR_OK) {
+            return err;
+        }
+
+        int64_t now = ds3231_time_to_timestamp(&time, ds3231_get_base_year(scheduler->ds3231));
+
+        if (now < alarm_due) {
+            return DS3231_ERR_OK;
+        }
+
+        ds3231_scheduler_dispatch_jobs(scheduler, now);
+
+        err = ds3231_scheduler_program_alarm(scheduler, now, &alarm_due);
+        if (err != DS3231_ERR_OK) {
+            return err;
+        }
+    } while (alarm_due != DS3231_JOB_DUE_NEVER);
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_scheduler_handle_alarm(ds3231_scheduler_t* scheduler)
+{
+    assert(scheduler);
+
+    ds3231_status_reg_t reg = {};
+
+    ds3231_err_t err = ds3231_get_status_reg(scheduler->ds3231, &reg);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    if (!reg.a1f && !reg.a2f) {
+        return DS3231_ERR_OK;
+    }
+
+    reg.a1f = 0U;
+    reg.a2f = 0U;
+
+    err = ds3231_set_status_reg(scheduler->ds3231, &reg);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    return ds3231_scheduler_run(scheduler);
+}
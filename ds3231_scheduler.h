@@ -0,0 +1,32 @@
+#ifndef DS3231_DS3231_SCHEDULER_H
+#define DS3231_DS3231_SCHEDULER_H
+
+#include "ds3231.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS3231_JOB_DUE_NEVER INT64_MAX
+
+typedef struct {
+    int64_t due;
+    uint32_t period;
+    void* job_user;
+    void (*job_callback)(void*);
+} ds3231_job_t;
+
+typedef struct {
+    ds3231_t const* ds3231;
+    ds3231_job_t* jobs;
+    size_t jobs_count;
+} ds3231_scheduler_t;
+
+ds3231_err_t ds3231_scheduler_initialize(ds3231_scheduler_t* scheduler,
+                                         ds3231_t const* ds3231,
+                                         ds3231_job_t* jobs,
+                                         size_t jobs_count);
+ds3231_err_t ds3231_scheduler_deinitialize(ds3231_scheduler_t* scheduler);
+
+ds3231_err_t ds3231_scheduler_run(ds3231_scheduler_t* scheduler);
+ds3231_err_t ds3231_scheduler_handle_alarm(ds3231_scheduler_t* scheduler);
+
+#endif // DS3231_DS3231_SCHEDULER_H
@@ -0,0 +1,72 @@
+#include "ds3231_stats.h"
+#include <assert.h>
+#include <string.h>
+
+static size_t ds3231_stats_get_latency_bucket(uint32_t latency)
+{
+    // bucket n holds latencies of bit width n, the last bucket collects the tail
+    size_t bucket = latency ? 32UL - (size_t)__builtin_clz(latency) : 0UL;
+
+    return bucket < DS3231_STATS_LATENCY_BUCKETS ? bucket : DS3231_STATS_LATENCY_BUCKETS - 1UL;
+}
+
+uint32_t ds3231_stats_get_ticks(ds3231_stats_t const* stats)
+{
+    if (stats && stats->get_ticks) {
+        return stats->get_ticks(stats->tick_user);
+    }
+
+    return 0U;
+}
+
+void ds3231_stats_record(ds3231_stats_t* stats,
+                         uint8_t address,
+                         bool is_write,
+                         size_t size,
+                         bool is_error,
+                         uint32_t start_ticks)
+{
+    if (!stats || address >= DS3231_STATS_ADDRESS_COUNT) {
+        return;
+    }
+
+    ds3231_reg_stats_t* reg_stats = &stats->reg_stats[address];
+
+    if (is_write) {
+        reg_stats->write_count++;
+        reg_stats->write_bytes += (uint32_t)size;
+    } else {
+        reg_stats->read_count++;
+        reg_stats->read_bytes += (uint32_t)size;
+    }
+
+    if (is_error) {
+        reg_stats->error_count++;
+    }
+
+    uint32_t latency = ds3231_stats_get_ticks(stats) - start_ticks;
+
+    reg_stats->latency_histogram[ds3231_stats_get_latency_bucket(latency)]++;
+}
+
+void ds3231_stats_reset(ds3231_stats_t* stats)
+{
+    assert(stats);
+
+    memset(stats->reg_stats, 0, sizeof(stats->reg_stats));
+}
+
+void ds3231_stats_dump(ds3231_stats_t const* stats,
+                       void (*dump)(void*, uint8_t, ds3231_reg_stats_t const*),
+                       void* dump_user)
+{
+    assert(stats && dump);
+
+    for (uint8_t address = 0U; address < DS3231_STATS_ADDRESS_COUNT; ++address) {
+        ds3231_reg_stats_t const* reg_stats = &stats->reg_stats[address];
+
+        if (reg_stats->read_count || reg_stats->write_count) {
+            dump(dump_user, address, reg_stats);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef DS3231_DS3231_STATS_H
+#define DS3231_DS3231_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS3231_STATS_ADDRESS_COUNT 0x13UL
+#define DS3231_STATS_LATENCY_BUCKETS 16UL
+
+typedef struct {
+    uint32_t read_count;
+    uint32_t write_count;
+    uint32_t read_bytes;
+    uint32_t write_bytes;
+    uint32_t error_count;
+    uint32_t latency_histogram[DS3231_STATS_LATENCY_BUCKETS];
+} ds3231_reg_stats_t;
+
+typedef struct {
+    void* tick_user;
+    uint32_t (*get_ticks)(void*);
+    ds3231_reg_stats_t reg_stats[DS3231_STATS_ADDRESS_COUNT];
+} ds3231_stats_t;
+
+uint32_t ds3231_stats_get_ticks(ds3231_stats_t const* stats);
+void ds3231_stats_record(ds3231_stats_t* stats,
+                         uint8_t address,
+                         bool is_write,
+                         size_t size,
+                         bool is_error,
+                         uint32_t start_ticks);
+
+void ds3231_stats_reset(ds3231_stats_t* stats);
+void ds3231_stats_dump(ds3231_stats_t const* stats,
+                       void (*dump)(void*, uint8_t, ds3231_reg_stats_t const*),
+                       void* dump_user);
+
+#endif // DS3231_DS3231_STATS_H
@@ -0,0 +1,118 @@
+#include "ds3231_sync.h"
+#include <assert.h>
+#include <string.h>
+
+#define DS3231_SYNC_MICROSECONDS 1000000ULL
+
+static uint32_t ds3231_sync_get_ticks(ds3231_sync_t const* sync)
+{
+    assert(sync && sync->get_ticks);
+
+    return sync->get_ticks(sync->tick_user);
+}
+
+static uint64_t ds3231_sync_ticks_to_microseconds(ds3231_sync_t const* sync, uint32_t ticks)
+{
+    assert(sync);
+
+    return (uint64_t)ticks * DS3231_SYNC_MICROSECONDS / sync->tick_frequency;
+}
+
+static uint32_t ds3231_sync_microseconds_to_ticks(ds3231_sync_t const* sync,
+                                                  uint64_t microseconds)
+{
+    assert(sync);
+
+    return (uint32_t)(microseconds * sync->tick_frequency / DS3231_SYNC_MICROSECONDS);
+}
+
+ds3231_err_t ds3231_sync_initialize(ds3231_sync_t* sync,
+                                    ds3231_t const* ds3231,
+                                    void* tick_user,
+                                    uint32_t (*get_ticks)(void*),
+                                    uint32_t tick_frequency,
+                                    uint32_t write_latency)
+{
+    assert(sync && ds3231 && get_ticks && tick_frequency);
+
+    memset(sync, 0, sizeof(*sync));
+
+    sync->ds3231 = ds3231;
+    sync->tick_user = tick_user;
+    sync->get_ticks = get_ticks;
+    sync->tick_frequency = tick_frequency;
+    sync->write_latency = write_latency;
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_sync_deinitialize(ds3231_sync_t* sync)
+{
+    assert(sync);
+
+    memset(sync, 0, sizeof(*sync));
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_sync_time(ds3231_sync_t const* sync,
+                              ds3231_sync_reference_t const* reference,
+                              ds3231_sync_result_t* result)
+{
+    assert(sync && reference && result);
+
+    // microseconds from the whole second of the reference up to now
+    uint64_t elapsed = reference->microseconds +
+                       ds3231_sync_ticks_to_microseconds(sync,
+                                                         ds3231_sync_get_ticks(sync) -
+                                                             reference->ticks);
+
+    // the write must start write_latency ahead of the boundary, skip a second if that is past
+    uint64_t latency = ds3231_sync_ticks_to_microseconds(sync, sync->write_latency);
+    uint64_t seconds = (elapsed + latency) / DS3231_SYNC_MICROSECONDS + 1U;
+    uint64_t boundary = seconds * DS3231_SYNC_MICROSECONDS - reference->microseconds;
+
+    uint32_t deadline = reference->ticks + ds3231_sync_microseconds_to_ticks(sync, boundary) -
+                        sync->write_latency;
+
+    uint16_t base_year = ds3231_get_base_year(sync->ds3231);
+
+    ds3231_time_t time = {};
+    ds3231_err_t err =
+        ds3231_timestamp_to_time(reference->timestamp + (int64_t)seconds, base_year, &time);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    // writing the seconds register restarts the countdown chain, so its phase follows the write
+    uint32_t ticks = ds3231_sync_get_ticks(sync);
+    while ((int32_t)(ticks - deadline) < 0) {
+        ticks = ds3231_sync_get_ticks(sync);
+    }
+
+    err = ds3231_set_time_data(sync->ds3231, &time);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    result->timestamp = reference->timestamp + (int64_t)seconds;
+    result->phase_error =
+        (int32_t)((int64_t)(int32_t)(ticks - deadline) * (int64_t)DS3231_SYNC_MICROSECONDS /
+                  sync->tick_frequency);
+
+    err = ds3231_get_time_data(sync->ds3231, &time);
+    if (err != DS3231_ERR_OK) {
+        return err;
+    }
+
+    uint64_t expected = reference->microseconds +
+                        ds3231_sync_ticks_to_microseconds(sync,
+                                                          ds3231_sync_get_ticks(sync) -
+                                                              reference->ticks);
+
+    result->residual_seconds = (int32_t)(ds3231_time_to_timestamp(&time, base_year) -
+                                         reference->timestamp -
+                                         (int64_t)(expected / DS3231_SYNC_MICROSECONDS));
+
+    return DS3231_ERR_OK;
+}
@@ -0,0 +1,40 @@
+#ifndef DS3231_DS3231_SYNC_H
+#define DS3231_DS3231_SYNC_H
+
+#include "ds3231.h"
+#include <stdint.h>
+
+typedef struct {
+    int64_t timestamp;
+    uint32_t microseconds;
+    uint32_t ticks;
+} ds3231_sync_reference_t;
+
+// phase_error is the only sub-second measure, the device readback resolves whole seconds only
+typedef struct {
+    int64_t timestamp;
+    int32_t phase_error;      // microseconds the write started after its deadline
+    int32_t residual_seconds; // device time minus reference time, read back after the write
+} ds3231_sync_result_t;
+
+typedef struct {
+    ds3231_t const* ds3231;
+    void* tick_user;
+    uint32_t (*get_ticks)(void*);
+    uint32_t tick_frequency;
+    uint32_t write_latency;
+} ds3231_sync_t;
+
+ds3231_err_t ds3231_sync_initialize(ds3231_sync_t* sync,
+                                    ds3231_t const* ds3231,
+                                    void* tick_user,
+                                    uint32_t (*get_ticks)(void*),
+                                    uint32_t tick_frequency,
+                                    uint32_t write_latency);
+ds3231_err_t ds3231_sync_deinitialize(ds3231_sync_t* sync);
+
+ds3231_err_t ds3231_sync_time(ds3231_sync_t const* sync,
+                              ds3231_sync_reference_t const* reference,
+                              ds3231_sync_result_t* result);
+
+#endif // DS3231_DS3231_SYNC_H
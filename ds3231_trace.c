@@ -0,0 +1,241 @@
+#include "ds3231_trace.h"
+#include <assert.h>
+#include <string.h>
+
+// record layout: flags, register address, size, 32-bit little endian ticks, payload
+static void ds3231_trace_recorder_record(ds3231_trace_recorder_t* recorder,
+                                         uint8_t flags,
+                                         uint8_t address,
+                                         uint8_t const* data,
+                                         size_t size)
+{
+    assert(recorder && data);
+
+    // once a record is dropped the trace stops, a later smaller record would leave a gap
+    if (recorder->is_overflow) {
+        return;
+    }
+
+    if (size > UINT8_MAX ||
+        recorder->buffer_size - recorder->buffer_length < DS3231_TRACE_RECORD_HEADER_SIZE + size) {
+        recorder->is_overflow = true;
+        return;
+    }
+
+    uint32_t ticks = recorder->get_ticks ? recorder->get_ticks(recorder->tick_user) : 0U;
+    uint8_t* record = &recorder->buffer[recorder->buffer_length];
+
+    record[0] = flags;
+    record[1] = address;
+    record[2] = (uint8_t)size;
+    record[3] = (uint8_t)ticks;
+    record[4] = (uint8_t)(ticks >> 8U);
+    record[5] = (uint8_t)(ticks >> 16U);
+    record[6] = (uint8_t)(ticks >> 24U);
+    memcpy(&record[DS3231_TRACE_RECORD_HEADER_SIZE], data, size);
+
+    recorder->buffer_length += DS3231_TRACE_RECORD_HEADER_SIZE + size;
+}
+
+static uint8_t const* ds3231_trace_replay_next(ds3231_trace_replay_t* replay,
+                                               uint8_t flags,
+                                               uint8_t address,
+                                               size_t size)
+{
+    assert(replay);
+
+    size_t remaining = replay->buffer_length - replay->buffer_position;
+
+    if (remaining < DS3231_TRACE_RECORD_HEADER_SIZE) {
+        return NULL;
+    }
+
+    uint8_t const* record = &replay->buffer[replay->buffer_position];
+
+    if ((record[0] & DS3231_TRACE_FLAG_WRITE) != (flags & DS3231_TRACE_FLAG_WRITE) ||
+        record[1] != address || record[2] != size ||
+        remaining < DS3231_TRACE_RECORD_HEADER_SIZE + size) {
+        return NULL;
+    }
+
+    replay->ticks = (uint32_t)record[3] | ((uint32_t)record[4] << 8U) |
+                    ((uint32_t)record[5] << 16U) | ((uint32_t)record[6] << 24U);
+    replay->buffer_position += DS3231_TRACE_RECORD_HEADER_SIZE + size;
+
+    return record;
+}
+
+void ds3231_trace_recorder_get_interface(ds3231_trace_recorder_t* recorder,
+                                         ds3231_interface_t* interface)
+{
+    assert(recorder && interface);
+
+    interface->bus_user = recorder;
+    interface->bus_initialize = ds3231_trace_recorder_bus_initialize;
+    interface->bus_deinitialize = ds3231_trace_recorder_bus_deinitialize;
+    interface->bus_write_data = ds3231_trace_recorder_bus_write_data;
+    interface->bus_read_data = ds3231_trace_recorder_bus_read_data;
+}
+
+ds3231_err_t ds3231_trace_recorder_bus_initialize(void* user)
+{
+    assert(user);
+
+    ds3231_trace_recorder_t* recorder = user;
+
+    if (recorder->interface.bus_initialize) {
+        return recorder->interface.bus_initialize(recorder->interface.bus_user);
+    }
+
+    return DS3231_ERR_NULL;
+}
+
+ds3231_err_t ds3231_trace_recorder_bus_deinitialize(void* user)
+{
+    assert(user);
+
+    ds3231_trace_recorder_t* recorder = user;
+
+    if (recorder->interface.bus_deinitialize) {
+        return recorder->interface.bus_deinitialize(recorder->interface.bus_user);
+    }
+
+    return DS3231_ERR_NULL;
+}
+
+ds3231_err_t ds3231_trace_recorder_bus_write_data(void* user,
+                                                  uint8_t write_address,
+                                                  uint8_t const* write_data,
+                                                  size_t write_size)
+{
+    assert(user && write_data);
+
+    ds3231_trace_recorder_t* recorder = user;
+
+    if (!recorder->interface.bus_write_data) {
+        return DS3231_ERR_NULL;
+    }
+
+    ds3231_err_t err = recorder->interface.bus_write_data(recorder->interface.bus_user,
+                                                          write_address,
+                                                          write_data,
+                                                          write_size);
+
+    ds3231_trace_recorder_record(recorder,
+                                 DS3231_TRACE_FLAG_WRITE |
+                                     (err != DS3231_ERR_OK ? DS3231_TRACE_FLAG_ERROR : 0),
+                                 write_address,
+                                 write_data,
+                                 write_size);
+
+    return err;
+}
+
+ds3231_err_t ds3231_trace_recorder_bus_read_data(void* user,
+                                                 uint8_t read_address,
+                                                 uint8_t* read_data,
+                                                 size_t read_size)
+{
+    assert(user && read_data);
+
+    ds3231_trace_recorder_t* recorder = user;
+
+    if (!recorder->interface.bus_read_data) {
+        return DS3231_ERR_NULL;
+    }
+
+    ds3231_err_t err = recorder->interface.bus_read_data(recorder->interface.bus_user,
+                                                         read_address,
+                                                         read_data,
+                                                         read_size);
+
+    ds3231_trace_recorder_record(recorder,
+                                 err != DS3231_ERR_OK ? DS3231_TRACE_FLAG_ERROR : 0,
+                                 read_address,
+                                 read_data,
+                                 read_size);
+
+    return err;
+}
+
+void ds3231_trace_replay_get_interface(ds3231_trace_replay_t* replay,
+                                       ds3231_interface_t* interface)
+{
+    assert(replay && interface);
+
+    interface->bus_user = replay;
+    interface->bus_initialize = ds3231_trace_replay_bus_initialize;
+    interface->bus_deinitialize = ds3231_trace_replay_bus_deinitialize;
+    interface->bus_write_data = ds3231_trace_replay_bus_write_data;
+    interface->bus_read_data = ds3231_trace_replay_bus_read_data;
+}
+
+ds3231_err_t ds3231_trace_replay_bus_initialize(void* user)
+{
+    assert(user);
+
+    ds3231_trace_replay_t* replay = user;
+
+    replay->buffer_position = 0UL;
+    replay->ticks = 0U;
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_trace_replay_bus_deinitialize(void* user)
+{
+    assert(user);
+
+    return DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_trace_replay_bus_write_data(void* user,
+                                                uint8_t write_address,
+                                                uint8_t const* write_data,
+                                                size_t write_size)
+{
+    assert(user && write_data);
+
+    ds3231_trace_replay_t* replay = user;
+
+    uint8_t const* record =
+        ds3231_trace_replay_next(replay, DS3231_TRACE_FLAG_WRITE, write_address, write_size);
+    if (!record) {
+        return DS3231_ERR_FAIL;
+    }
+
+    if (replay->verify_writes &&
+        memcmp(&record[DS3231_TRACE_RECORD_HEADER_SIZE], write_data, write_size) != 0) {
+        return DS3231_ERR_FAIL;
+    }
+
+    return (record[0] & DS3231_TRACE_FLAG_ERROR) ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
+
+ds3231_err_t ds3231_trace_replay_bus_read_data(void* user,
+                                               uint8_t read_address,
+                                               uint8_t* read_data,
+                                               size_t read_size)
+{
+    assert(user && read_data);
+
+    ds3231_trace_replay_t* replay = user;
+
+    uint8_t const* record = ds3231_trace_replay_next(replay, 0U, read_address, read_size);
+    if (!record) {
+        return DS3231_ERR_FAIL;
+    }
+
+    memcpy(read_data, &record[DS3231_TRACE_RECORD_HEADER_SIZE], read_size);
+
+    return (record[0] & DS3231_TRACE_FLAG_ERROR) ? DS3231_ERR_FAIL : DS3231_ERR_OK;
+}
+
+uint32_t ds3231_trace_replay_get_ticks(void* user)
+{
+    assert(user);
+
+    ds3231_trace_replay_t const* replay = user;
+
+    return replay->ticks;
+}
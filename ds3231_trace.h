@@ -0,0 +1,63 @@
+#ifndef DS3231_DS3231_TRACE_H
+#define DS3231_DS3231_TRACE_H
+
+#include "ds3231_config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS3231_TRACE_RECORD_HEADER_SIZE 7UL
+
+typedef enum {
+    DS3231_TRACE_FLAG_WRITE = 1 << 0,
+    DS3231_TRACE_FLAG_ERROR = 1 << 1,
+} ds3231_trace_flag_t;
+
+typedef struct {
+    ds3231_interface_t interface;
+    void* tick_user;
+    uint32_t (*get_ticks)(void*);
+    uint8_t* buffer;
+    size_t buffer_size;
+    size_t buffer_length;
+    bool is_overflow;
+} ds3231_trace_recorder_t;
+
+typedef struct {
+    uint8_t const* buffer;
+    size_t buffer_length;
+    size_t buffer_position;
+    bool verify_writes;
+    uint32_t ticks;
+} ds3231_trace_replay_t;
+
+void ds3231_trace_recorder_get_interface(ds3231_trace_recorder_t* recorder,
+                                         ds3231_interface_t* interface);
+
+ds3231_err_t ds3231_trace_recorder_bus_initialize(void* user);
+ds3231_err_t ds3231_trace_recorder_bus_deinitialize(void* user);
+ds3231_err_t ds3231_trace_recorder_bus_write_data(void* user,
+                                                  uint8_t write_address,
+                                                  uint8_t const* write_data,
+                                                  size_t write_size);
+ds3231_err_t ds3231_trace_recorder_bus_read_data(void* user,
+                                                 uint8_t read_address,
+                                                 uint8_t* read_data,
+                                                 size_t read_size);
+
+void ds3231_trace_replay_get_interface(ds3231_trace_replay_t* replay,
+                                       ds3231_interface_t* interface);
+
+ds3231_err_t ds3231_trace_replay_bus_initialize(void* user);
+ds3231_err_t ds3231_trace_replay_bus_deinitialize(void* user);
+ds3231_err_t ds3231_trace_replay_bus_write_data(void* user,
+                                                uint8_t write_address,
+                                                uint8_t const* write_data,
+                                                size_t write_size);
+ds3231_err_t ds3231_trace_replay_bus_read_data(void* user,
+                                               uint8_t read_address,
+                                               uint8_t* read_data,
+                                               size_t read_size);
+uint32_t ds3231_trace_replay_get_ticks(void* user);
+
+#endif // DS3231_DS3231_TRACE_H
@@ -0,0 +1,65 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds3231_codec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_RECORD_COUNT 4096UL
+#define BENCH_ROUNDS 2000UL
+
+static ds3231_time_t times[BENCH_RECORD_COUNT];
+static ds3231_time_raw_t raws[BENCH_RECORD_COUNT];
+static int64_t timestamps[BENCH_RECORD_COUNT];
+
+static double bench_now(void)
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec * 1E9 + (double)now.tv_nsec;
+}
+
+static void bench_report(char const* name, double start, double end)
+{
+    printf("%-18s %6.2f ns/record\n",
+           name,
+           (end - start) / (double)(BENCH_RECORD_COUNT * BENCH_ROUNDS));
+}
+
+int main(void)
+{
+    for (size_t index = 0UL; index < BENCH_RECORD_COUNT; ++index) {
+        times[index] = (ds3231_time_t){.century = (uint8_t)(index & 0x01U),
+                                       .year = (uint8_t)(index % 100U),
+                                       .month = (uint8_t)(1U + index % 12U),
+                                       .date = (uint8_t)(1U + index % 28U),
+                                       .day = (uint8_t)(1U + index % 7U),
+                                       .hour = (uint8_t)(index % 24U),
+                                       .minute = (uint8_t)(index % 60U),
+                                       .second = (uint8_t)((index * 7UL) % 60U)};
+    }
+
+    double start = bench_now();
+    for (size_t round = 0UL; round < BENCH_ROUNDS; ++round) {
+        ds3231_encode_time_array(times, raws, BENCH_RECORD_COUNT, round & 0x01U);
+    }
+    bench_report("encode", start, bench_now());
+
+    start = bench_now();
+    for (size_t round = 0UL; round < BENCH_ROUNDS; ++round) {
+        ds3231_decode_time_array(raws, times, BENCH_RECORD_COUNT);
+    }
+    bench_report("decode", start, bench_now());
+
+    start = bench_now();
+    for (size_t round = 0UL; round < BENCH_ROUNDS; ++round) {
+        ds3231_decode_timestamp_array(raws, timestamps, BENCH_RECORD_COUNT, 2000U);
+    }
+    bench_report("decode timestamp", start, bench_now());
+
+    // keeps the results observable
+    printf("checksum %lld\n", (long long)(timestamps[0] + times[BENCH_RECORD_COUNT - 1UL].second));
+
+    return EXIT_SUCCESS;
+}
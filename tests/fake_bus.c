@@ -0,0 +1,114 @@
+#include "fake_bus.h"
+#include <assert.h>
+
+static ds3231_err_t fake_bus_initialize(void* user)
+{
+    assert(user);
+
+    return DS3231_ERR_OK;
+}
+
+static ds3231_err_t fake_bus_deinitialize(void* user)
+{
+    assert(user);
+
+    return DS3231_ERR_OK;
+}
+
+// register pointer wraps from the last register back to seconds, as on the device
+static ds3231_err_t fake_bus_write_data(void* user,
+                                        uint8_t write_address,
+                                        uint8_t const* write_data,
+                                        size_t write_size)
+{
+    assert(user && write_data);
+
+    fake_bus_t* bus = user;
+
+    // the next fail_count transfers are not acknowledged and leave the registers alone
+    if (bus->fail_count) {
+        bus->fail_count--;
+        return DS3231_ERR_FAIL;
+    }
+
+    for (size_t index = 0UL; index < write_size; ++index) {
+        size_t address = (write_address + index) % FAKE_BUS_REG_COUNT;
+
+        // osf, a2f and a1f only clear on a written 0, a written 1 leaves them as they are
+        if (address == FAKE_BUS_STATUS_ADDRESS) {
+            uint8_t flags =
+                (uint8_t)(bus->regs[address] & write_data[index] & FAKE_BUS_STATUS_FLAGS);
+
+            bus->regs[address] = (uint8_t)((write_data[index] & ~FAKE_BUS_STATUS_FLAGS) | flags);
+        } else {
+            bus->regs[address] = write_data[index];
+        }
+    }
+
+    bus->write_count++;
+
+    return DS3231_ERR_OK;
+}
+
+static ds3231_err_t fake_bus_read_data(void* user,
+                                       uint8_t read_address,
+                                       uint8_t* read_data,
+                                       size_t read_size)
+{
+    assert(user && read_data);
+
+    fake_bus_t* bus = user;
+
+    if (bus->fail_count) {
+        bus->fail_count--;
+        return DS3231_ERR_FAIL;
+    }
+
+    for (size_t index = 0UL; index < read_size; ++index) {
+        read_data[index] = bus->regs[(read_address + index) % FAKE_BUS_REG_COUNT];
+    }
+
+    bus->read_count++;
+    bus->read_bytes += read_size;
+
+    // lets a test move the device on between transfers
+    if (bus->read_callback) {
+        bus->read_callback(bus->read_user);
+    }
+
+    return DS3231_ERR_OK;
+}
+
+void fake_bus_get_interface(fake_bus_t* bus, ds3231_interface_t* interface)
+{
+    assert(bus && interface);
+
+    interface->bus_user = bus;
+    interface->bus_initialize = fake_bus_initialize;
+    interface->bus_deinitialize = fake_bus_deinitialize;
+    interface->bus_write_data = fake_bus_write_data;
+    interface->bus_read_data = fake_bus_read_data;
+}
+
+void fake_bus_set_time(fake_bus_t* bus, ds3231_time_t const* time)
+{
+    assert(bus && time);
+
+    bus->regs[0x00] = fake_bus_bin_to_bcd(time->second);
+    bus->regs[0x01] = fake_bus_bin_to_bcd(time->minute);
+    bus->regs[0x02] = fake_bus_bin_to_bcd(time->hour);
+    bus->regs[0x03] = time->day;
+    bus->regs[0x04] = fake_bus_bin_to_bcd(time->date);
+    bus->regs[0x05] = (uint8_t)((time->century << 7U) | fake_bus_bin_to_bcd(time->month));
+    bus->regs[0x06] = fake_bus_bin_to_bcd(time->year);
+}
+
+uint8_t fake_bus_bcd_to_bin(uint8_t bcd)
+{
+    return (uint8_t)((bcd >> 4U) * 10U + (bcd & 0x0FU));
+}
+
+uint8_t fake_bus_bin_to_bcd(uint8_t bin)
+{
+    return (uint8_t)(((bin / 10U) << 4U) | (bin % 10U));
+}
@@ -0,0 +1,28 @@
+#ifndef DS3231_TESTS_FAKE_BUS_H
+#define DS3231_TESTS_FAKE_BUS_H
+
+#include "ds3231_config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define FAKE_BUS_REG_COUNT 0x13UL
+#define FAKE_BUS_STATUS_ADDRESS 0x0FUL
+#define FAKE_BUS_STATUS_FLAGS 0x83U
+
+typedef struct {
+    uint8_t regs[FAKE_BUS_REG_COUNT];
+    size_t read_count;
+    size_t read_bytes;
+    size_t write_count;
+    size_t fail_count;
+    void* read_user;
+    void (*read_callback)(void*);
+} fake_bus_t;
+
+void fake_bus_get_interface(fake_bus_t* bus, ds3231_interface_t* interface);
+
+void fake_bus_set_time(fake_bus_t* bus, ds3231_time_t const* time);
+uint8_t fake_bus_bcd_to_bin(uint8_t bcd);
+uint8_t fake_bus_bin_to_bcd(uint8_t bin);
+
+#endif // DS3231_TESTS_FAKE_BUS_H
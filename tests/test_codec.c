@@ -0,0 +1,110 @@
+#include "ds3231_codec.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+#define TEST_RECORD_COUNT 257UL
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_t ds3231;
+    uint32_t seed;
+    ds3231_time_t times[TEST_RECORD_COUNT];
+    ds3231_time_raw_t raws[TEST_RECORD_COUNT];
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static uint32_t test_random(uint32_t range)
+{
+    fixture.seed = fixture.seed * 1664525U + 1013904223U;
+
+    return (fixture.seed >> 8U) % range;
+}
+
+static void test_setup(bool sys_12_n24)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    ds3231_config_t config = {.sys_12_n24 = sys_12_n24};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&fixture.bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &interface) == DS3231_ERR_OK);
+
+    fixture.seed = sys_12_n24 ? 12U : 24U;
+
+    // every hour, minute and second shows up, the rest is random but valid
+    for (size_t index = 0UL; index < TEST_RECORD_COUNT; ++index) {
+        ds3231_time_t* time = &fixture.times[index];
+
+        time->century = (uint8_t)test_random(2U);
+        time->year = (uint8_t)test_random(100U);
+        time->month = (uint8_t)(1U + test_random(12U));
+        time->date = (uint8_t)(1U + test_random(28U));
+        time->day = (uint8_t)(1U + test_random(7U));
+        time->hour = (uint8_t)(index % 24U);
+        time->minute = (uint8_t)(index % 60U);
+        time->second = (uint8_t)((index * 7UL) % 60U);
+    }
+}
+
+// the setter fills the register file, the raw record is taken from there
+static void test_store_raws(void)
+{
+    for (size_t index = 0UL; index < TEST_RECORD_COUNT; ++index) {
+        TEST_ASSERT(ds3231_set_time_data(&fixture.ds3231, &fixture.times[index]) ==
+                    DS3231_ERR_OK);
+
+        memcpy(fixture.raws[index].data, fixture.bus.regs, DS3231_TIME_RAW_SIZE);
+    }
+}
+
+static void test_decode_matches_getter(bool sys_12_n24)
+{
+    test_setup(sys_12_n24);
+    test_store_raws();
+
+    ds3231_time_t times[TEST_RECORD_COUNT] = {};
+    int64_t timestamps[TEST_RECORD_COUNT] = {};
+
+    ds3231_decode_time_array(fixture.raws, times, TEST_RECORD_COUNT);
+    ds3231_decode_timestamp_array(fixture.raws,
+                                  timestamps,
+                                  TEST_RECORD_COUNT,
+                                  ds3231_get_base_year(&fixture.ds3231));
+
+    for (size_t index = 0UL; index < TEST_RECORD_COUNT; ++index) {
+        memcpy(fixture.bus.regs, fixture.raws[index].data, DS3231_TIME_RAW_SIZE);
+
+        ds3231_time_t time = {};
+        TEST_ASSERT(ds3231_get_time_data(&fixture.ds3231, &time) == DS3231_ERR_OK);
+
+        TEST_ASSERT(memcmp(&times[index], &time, sizeof(time)) == 0);
+        TEST_ASSERT(memcmp(&time, &fixture.times[index], sizeof(time)) == 0);
+        TEST_ASSERT(timestamps[index] ==
+                    ds3231_time_to_timestamp(&time, ds3231_get_base_year(&fixture.ds3231)));
+    }
+}
+
+static void test_encode_matches_setter(bool sys_12_n24)
+{
+    test_setup(sys_12_n24);
+    test_store_raws();
+
+    ds3231_time_raw_t raws[TEST_RECORD_COUNT] = {};
+
+    ds3231_encode_time_array(fixture.times, raws, TEST_RECORD_COUNT, sys_12_n24);
+
+    TEST_ASSERT(memcmp(raws, fixture.raws, sizeof(raws)) == 0);
+}
+
+int main(void)
+{
+    test_decode_matches_getter(false);
+    test_decode_matches_getter(true);
+    test_encode_matches_setter(false);
+    test_encode_matches_setter(true);
+
+    return EXIT_SUCCESS;
+}
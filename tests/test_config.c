@@ -0,0 +1,160 @@
+#include "ds3231.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+// control and status as the device comes out of power-on reset
+#define TEST_CONTROL_POWER_ON 0x1CU
+#define TEST_STATUS_POWER_ON 0x88U
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_t ds3231;
+    ds3231_interface_t interface;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static void test_setup(uint8_t status)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    fake_bus_get_interface(&fixture.bus, &fixture.interface);
+
+    ds3231_time_t time = {.year = 23U, .month = 11U, .date = 14U, .day = 3U, .hour = 22U};
+    fake_bus_set_time(&fixture.bus, &time);
+
+    fixture.bus.regs[0x0E] = TEST_CONTROL_POWER_ON;
+    fixture.bus.regs[0x0F] = status;
+}
+
+static void test_zero_config_keeps_power_on(void)
+{
+    test_setup(TEST_STATUS_POWER_ON);
+
+    ds3231_config_t config = {};
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &fixture.interface) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.read_count == 1UL);
+    TEST_ASSERT(fixture.bus.write_count == 0UL);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == TEST_CONTROL_POWER_ON);
+    TEST_ASSERT(fixture.bus.regs[0x0F] == TEST_STATUS_POWER_ON);
+}
+
+static void test_initialize_converts_alarms(void)
+{
+    test_setup(TEST_STATUS_POWER_ON);
+
+    // alarm1 masked at 07, alarm2 at 23
+    fixture.bus.regs[0x09] = 0x87U;
+    fixture.bus.regs[0x0C] = 0x23U;
+
+    ds3231_config_t config = {.sys_12_n24 = true, .validate = true};
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &fixture.interface) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x70U);
+    TEST_ASSERT(fixture.bus.regs[0x09] == 0xC7U);
+    TEST_ASSERT(fixture.bus.regs[0x0C] == 0x71U);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == TEST_CONTROL_POWER_ON);
+}
+
+static void test_warm_boot_reads_config_only(void)
+{
+    test_setup(TEST_STATUS_POWER_ON & ~0x80U);
+
+    ds3231_config_t config = {};
+    ds3231_time_t time = {};
+    ds3231_boot_t boot = {};
+
+    TEST_ASSERT(ds3231_boot(&fixture.ds3231, &config, &fixture.interface, &time, &boot) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(boot == DS3231_BOOT_WARM);
+    TEST_ASSERT(fixture.bus.read_count == 1UL);
+    TEST_ASSERT(fixture.bus.read_bytes == 3UL);
+    TEST_ASSERT(fixture.bus.write_count == 0UL);
+}
+
+static void test_warm_boot_reconfigures(void)
+{
+    test_setup(TEST_STATUS_POWER_ON & ~0x80U);
+
+    ds3231_config_t config = {.a1ie = true, .disable_32khz = true};
+    ds3231_time_t time = {};
+    ds3231_boot_t boot = {};
+
+    TEST_ASSERT(ds3231_boot(&fixture.ds3231, &config, &fixture.interface, &time, &boot) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(boot == DS3231_BOOT_RECONFIGURED);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == (TEST_CONTROL_POWER_ON | 0x01U));
+    TEST_ASSERT(fixture.bus.regs[0x0F] == 0x00U);
+}
+
+// an alarm fires right after the configuration has been read
+static void test_raise_alarm1_flag(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    fixture.bus.regs[0x0F] |= 0x01U;
+    fixture.bus.read_callback = NULL;
+}
+
+static void test_status_write_keeps_raised_flag(void)
+{
+    test_setup(TEST_STATUS_POWER_ON & ~0x80U);
+
+    fixture.bus.read_user = &fixture;
+    fixture.bus.read_callback = test_raise_alarm1_flag;
+
+    ds3231_config_t config = {.disable_32khz = true};
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &fixture.interface) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.regs[0x0F] == 0x01U);
+}
+
+static void test_control_write_skips_status(void)
+{
+    test_setup(TEST_STATUS_POWER_ON | 0x03U);
+
+    ds3231_config_t config = {.a2ie = true};
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &fixture.interface) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.write_count == 1UL);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == (TEST_CONTROL_POWER_ON | 0x02U));
+    TEST_ASSERT(fixture.bus.regs[0x0F] == (TEST_STATUS_POWER_ON | 0x03U));
+}
+
+static void test_cold_boot_sets_time(void)
+{
+    test_setup(TEST_STATUS_POWER_ON | 0x03U);
+
+    ds3231_config_t config = {};
+    ds3231_time_t time = {.year = 24U, .month = 2U, .date = 29U, .day = 4U, .hour = 9U};
+    ds3231_boot_t boot = {};
+
+    TEST_ASSERT(ds3231_boot(&fixture.ds3231, &config, &fixture.interface, &time, &boot) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(boot == DS3231_BOOT_COLD);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x09U);
+    TEST_ASSERT(fixture.bus.regs[0x04] == 0x29U);
+    TEST_ASSERT(fixture.bus.regs[0x06] == 0x24U);
+
+    // oscillator stop and stale alarm flags cleared, en32khz left on
+    TEST_ASSERT(fixture.bus.regs[0x0F] == 0x08U);
+}
+
+int main(void)
+{
+    test_zero_config_keeps_power_on();
+    test_initialize_converts_alarms();
+    test_warm_boot_reads_config_only();
+    test_warm_boot_reconfigures();
+    test_status_write_keeps_raised_flag();
+    test_control_write_skips_status();
+    test_cold_boot_sets_time();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+#include "ds3231.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_t ds3231;
+    size_t rollover_reads;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static void test_set_time(uint8_t hour, uint8_t minute, uint8_t second)
+{
+    ds3231_time_t time = {.year = 23U, .month = 11U, .date = 14U, .day = 3U};
+
+    time.hour = hour;
+    time.minute = minute;
+    time.second = second;
+
+    fake_bus_set_time(&fixture.bus, &time);
+}
+
+// the device reaches the next hour after a few reads
+static void test_rollover(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    if (fixture.rollover_reads && --fixture.rollover_reads == 0UL) {
+        test_set_time(22U, 0U, 0U);
+    }
+}
+
+static void test_setup(void)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    ds3231_config_t config = {};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&fixture.bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &interface) == DS3231_ERR_OK);
+
+    fixture.bus.read_user = &fixture;
+    fixture.bus.read_callback = test_rollover;
+    fixture.bus.read_count = 0UL;
+    fixture.bus.write_count = 0UL;
+}
+
+static void test_alarms_follow_mode(void)
+{
+    test_setup();
+    test_set_time(22U, 13U, 30U);
+
+    // alarm1 masked at 07, alarm2 at 23
+    fixture.bus.regs[0x09] = 0x87U;
+    fixture.bus.regs[0x0C] = 0x23U;
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, true) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.ds3231.config.sys_12_n24);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x70U);
+    TEST_ASSERT(fixture.bus.regs[0x09] == 0xC7U);
+    TEST_ASSERT(fixture.bus.regs[0x0C] == 0x71U);
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, false) == DS3231_ERR_OK);
+    TEST_ASSERT(!fixture.ds3231.config.sys_12_n24);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x22U);
+    TEST_ASSERT(fixture.bus.regs[0x09] == 0x87U);
+    TEST_ASSERT(fixture.bus.regs[0x0C] == 0x23U);
+
+    // nothing to convert, nothing written
+    fixture.bus.write_count = 0UL;
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, false) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.write_count == 0UL);
+}
+
+static void test_waits_out_rollover(void)
+{
+    test_setup();
+    test_set_time(21U, 59U, 59U);
+
+    fixture.rollover_reads = 3UL;
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, true) == DS3231_ERR_OK);
+
+    // the converted hour is the one after the rollover, 10 pm and not 9 pm
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x70U);
+    TEST_ASSERT(fixture.bus.regs[0x01] == 0x00U);
+}
+
+static void test_stuck_clock_fails(void)
+{
+    test_setup();
+    test_set_time(21U, 59U, 59U);
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, true) == DS3231_ERR_FAIL);
+    TEST_ASSERT(!fixture.ds3231.config.sys_12_n24);
+    TEST_ASSERT(fixture.bus.write_count == 0UL);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x21U);
+
+    // the wait is bounded to about a second of 13 byte bursts on the bus
+    TEST_ASSERT(fixture.bus.read_count * 9UL * (13UL + 3UL) <=
+                DS3231_BUS_FREQUENCY + 9UL * (13UL + 3UL));
+}
+
+static void test_no_wait_when_hour_kept(void)
+{
+    test_setup();
+    test_set_time(21U, 59U, 59U);
+
+    // alarm1 still at 7 am in 12h mode, the time hour is already in 24h mode
+    fixture.bus.regs[0x09] = 0x47U;
+
+    TEST_ASSERT(ds3231_set_hour_mode(&fixture.ds3231, false) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.read_count == 1UL);
+    TEST_ASSERT(fixture.bus.regs[0x02] == 0x21U);
+    TEST_ASSERT(fixture.bus.regs[0x09] == 0x07U);
+}
+
+int main(void)
+{
+    test_alarms_follow_mode();
+    test_waits_out_rollover();
+    test_stuck_clock_fails();
+    test_no_wait_when_hour_kept();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#include "ds3231_i2c_dev.h"
+#include "test_utility.h"
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+#include <stdarg.h>
+#include <string.h>
+
+#define TEST_MESSAGES_MAX 2UL
+#define TEST_BUFFER_SIZE 32UL
+
+typedef struct {
+    size_t ioctl_count;
+    unsigned long request;
+    uint32_t nmsgs;
+    struct i2c_msg messages[TEST_MESSAGES_MAX];
+    uint8_t buffers[TEST_MESSAGES_MAX][TEST_BUFFER_SIZE];
+    int result;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+int __wrap_ioctl(int fd, unsigned long request, ...);
+
+// linked in place of ioctl, records the transfer and answers reads with the register address
+int __wrap_ioctl(int fd, unsigned long request, ...)
+{
+    TEST_ASSERT(fd >= 0);
+
+    va_list args;
+    va_start(args, request);
+    struct i2c_rdwr_ioctl_data* transfer = va_arg(args, struct i2c_rdwr_ioctl_data*);
+    va_end(args);
+
+    fixture.ioctl_count++;
+    fixture.request = request;
+    fixture.nmsgs = transfer->nmsgs;
+
+    TEST_ASSERT(transfer->nmsgs <= TEST_MESSAGES_MAX);
+
+    for (uint32_t index = 0U; index < transfer->nmsgs; ++index) {
+        struct i2c_msg* message = &transfer->msgs[index];
+
+        TEST_ASSERT(message->len <= TEST_BUFFER_SIZE);
+
+        if (message->flags & I2C_M_RD) {
+            for (uint16_t byte = 0U; byte < message->len; ++byte) {
+                message->buf[byte] = (uint8_t)(transfer->msgs[0].buf[0] + byte);
+            }
+        }
+
+        fixture.messages[index] = *message;
+        memcpy(fixture.buffers[index], message->buf, message->len);
+    }
+
+    return fixture.result;
+}
+
+static void test_setup(ds3231_i2c_dev_t* i2c_dev)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    i2c_dev->path = "/dev/null";
+    i2c_dev->address = 0x68U;
+    i2c_dev->fd = -1;
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_initialize(i2c_dev) == DS3231_ERR_OK);
+    TEST_ASSERT(i2c_dev->fd >= 0);
+}
+
+static void test_read_is_one_combined_transfer(void)
+{
+    ds3231_i2c_dev_t i2c_dev = {};
+    test_setup(&i2c_dev);
+
+    uint8_t data[7] = {};
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_read_data(&i2c_dev, 0x0EU, data, sizeof(data)) ==
+                DS3231_ERR_OK);
+
+    TEST_ASSERT(fixture.ioctl_count == 1UL);
+    TEST_ASSERT(fixture.request == I2C_RDWR);
+    TEST_ASSERT(fixture.nmsgs == 2U);
+
+    TEST_ASSERT(fixture.messages[0].addr == 0x68U);
+    TEST_ASSERT(!(fixture.messages[0].flags & I2C_M_RD));
+    TEST_ASSERT(fixture.messages[0].len == 1U);
+    TEST_ASSERT(fixture.buffers[0][0] == 0x0EU);
+
+    TEST_ASSERT(fixture.messages[1].addr == 0x68U);
+    TEST_ASSERT(fixture.messages[1].flags & I2C_M_RD);
+    TEST_ASSERT(fixture.messages[1].len == sizeof(data));
+
+    for (size_t index = 0UL; index < sizeof(data); ++index) {
+        TEST_ASSERT(data[index] == 0x0EU + index);
+    }
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_deinitialize(&i2c_dev) == DS3231_ERR_OK);
+}
+
+static void test_write_prepends_address(void)
+{
+    ds3231_i2c_dev_t i2c_dev = {};
+    test_setup(&i2c_dev);
+
+    uint8_t data[3] = {0x1CU, 0x08U, 0xF0U};
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_write_data(&i2c_dev, 0x0EU, data, sizeof(data)) ==
+                DS3231_ERR_OK);
+
+    TEST_ASSERT(fixture.ioctl_count == 1UL);
+    TEST_ASSERT(fixture.request == I2C_RDWR);
+    TEST_ASSERT(fixture.nmsgs == 1U);
+    TEST_ASSERT(fixture.messages[0].addr == 0x68U);
+    TEST_ASSERT(!(fixture.messages[0].flags & I2C_M_RD));
+    TEST_ASSERT(fixture.messages[0].len == 1U + sizeof(data));
+    TEST_ASSERT(fixture.buffers[0][0] == 0x0EU);
+    TEST_ASSERT(memcmp(&fixture.buffers[0][1], data, sizeof(data)) == 0);
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_deinitialize(&i2c_dev) == DS3231_ERR_OK);
+}
+
+static void test_write_size_limit(void)
+{
+    ds3231_i2c_dev_t i2c_dev = {};
+    test_setup(&i2c_dev);
+
+    uint8_t data[DS3231_I2C_DEV_WRITE_SIZE_MAX + 1UL] = {};
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_write_data(&i2c_dev, 0x00U, data, sizeof(data)) ==
+                DS3231_ERR_FAIL);
+    TEST_ASSERT(fixture.ioctl_count == 0UL);
+
+    // the whole register file still fits
+    TEST_ASSERT(ds3231_i2c_dev_bus_write_data(&i2c_dev,
+                                              0x00U,
+                                              data,
+                                              DS3231_I2C_DEV_WRITE_SIZE_MAX) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.ioctl_count == 1UL);
+    TEST_ASSERT(fixture.messages[0].len == 1U + DS3231_I2C_DEV_WRITE_SIZE_MAX);
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_deinitialize(&i2c_dev) == DS3231_ERR_OK);
+}
+
+static void test_ioctl_failure(void)
+{
+    ds3231_i2c_dev_t i2c_dev = {};
+    test_setup(&i2c_dev);
+
+    fixture.result = -1;
+
+    uint8_t data[2] = {};
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_read_data(&i2c_dev, 0x11U, data, sizeof(data)) ==
+                DS3231_ERR_FAIL);
+    TEST_ASSERT(ds3231_i2c_dev_bus_write_data(&i2c_dev, 0x10U, data, sizeof(data)) ==
+                DS3231_ERR_FAIL);
+
+    TEST_ASSERT(ds3231_i2c_dev_bus_deinitialize(&i2c_dev) == DS3231_ERR_OK);
+}
+
+int main(void)
+{
+    test_read_is_one_combined_transfer();
+    test_write_prepends_address();
+    test_write_size_limit();
+    test_ioctl_failure();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,261 @@
+#include "ds3231_scheduler.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+// 2023-11-14 22:13:30, half way through a minute
+#define TEST_NOW 1700000010LL
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_t ds3231;
+    ds3231_scheduler_t scheduler;
+    size_t callback_count;
+    int64_t advance;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static void test_set_now(int64_t now)
+{
+    ds3231_time_t time = {};
+    TEST_ASSERT(ds3231_timestamp_to_time(now, ds3231_get_base_year(&fixture.ds3231), &time) ==
+                DS3231_ERR_OK);
+
+    fake_bus_set_time(&fixture.bus, &time);
+}
+
+static void test_callback(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    fixture.callback_count++;
+
+    // a slow callback, the clock moves on while it runs
+    if (fixture.advance) {
+        ds3231_time_t time = {};
+        ds3231_get_time_data(&fixture.ds3231, &time);
+
+        test_set_now(ds3231_time_to_timestamp(&time, ds3231_get_base_year(&fixture.ds3231)) +
+                     fixture.advance);
+        fixture.advance = 0;
+    }
+}
+
+static void test_setup(ds3231_job_t* jobs, size_t jobs_count)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    ds3231_config_t config = {};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&fixture.bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_scheduler_initialize(&fixture.scheduler, &fixture.ds3231, jobs, jobs_count) ==
+                DS3231_ERR_OK);
+
+    test_set_now(TEST_NOW);
+
+    fixture.bus.read_count = 0UL;
+    fixture.bus.write_count = 0UL;
+}
+
+static uint8_t test_get_alarm1_mask(void)
+{
+    uint8_t mask = {};
+
+    for (uint8_t index = 0U; index < 4U; ++index) {
+        mask |= (uint8_t)(((fixture.bus.regs[0x07 + index] >> 7U) & 0x01U) << index);
+    }
+
+    return mask;
+}
+
+static uint8_t test_get_alarm2_mask(void)
+{
+    uint8_t mask = {};
+
+    for (uint8_t index = 0U; index < 3U; ++index) {
+        mask |= (uint8_t)(((fixture.bus.regs[0x0B + index] >> 7U) & 0x01U) << index);
+    }
+
+    return mask;
+}
+
+static void test_periodic_catch_up(void)
+{
+    ds3231_job_t jobs[] = {
+        {.due = TEST_NOW - 1000, .period = 60U, .job_user = &fixture, .job_callback = test_callback},
+    };
+    test_setup(jobs, 1UL);
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+
+    // missed periods collapse into a single dispatch, the phase of the period is kept
+    TEST_ASSERT(fixture.callback_count == 1UL);
+    TEST_ASSERT(jobs[0].due > TEST_NOW && jobs[0].due <= TEST_NOW + 60);
+    TEST_ASSERT((jobs[0].due - (TEST_NOW - 1000)) % 60 == 0);
+}
+
+static void test_alarm_selection(void)
+{
+    static struct {
+        int64_t delta;
+        bool is_alarm2;
+        uint8_t mask;
+    } const cases[] = {
+        {17, false, DS3231_ALARM1_SEC_MATCH},
+        {600 + 7, false, DS3231_ALARM1_MIN_SEC_MATCH},
+        {7200 + 7, false, DS3231_ALARM1_HR_MIN_SEC_MATCH},
+        {3 * 86400 + 7, false, DS3231_ALARM1_DATE_HR_MIN_SEC_MATCH},
+        {30, true, DS3231_ALARM2_MIN_MATCH},
+        {7200 + 30, true, DS3231_ALARM2_HR_MIN_MATCH},
+        {3 * 86400 + 30, true, DS3231_ALARM2_DATE_HR_MIN_MATCH},
+    };
+
+    for (size_t index = 0UL; index < sizeof(cases) / sizeof(cases[0]); ++index) {
+        ds3231_job_t jobs[] = {
+            {.due = TEST_NOW + cases[index].delta, .period = 0U},
+        };
+        test_setup(jobs, 1UL);
+
+        TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+
+        ds3231_time_t due = {};
+        TEST_ASSERT(ds3231_timestamp_to_time(
+                        jobs[0].due, ds3231_get_base_year(&fixture.ds3231), &due) == DS3231_ERR_OK);
+
+        uint8_t control = fixture.bus.regs[0x0E];
+
+        TEST_ASSERT(((control >> 2U) & 0x01U) == 1U);
+        TEST_ASSERT(((control >> 1U) & 0x01U) == cases[index].is_alarm2);
+        TEST_ASSERT((control & 0x01U) == !cases[index].is_alarm2);
+
+        if (cases[index].is_alarm2) {
+            TEST_ASSERT(test_get_alarm2_mask() == cases[index].mask);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x0B] & 0x7FU) == due.minute);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x0C] & 0x3FU) == due.hour);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x0D] & 0x3FU) == due.date);
+        } else {
+            TEST_ASSERT(test_get_alarm1_mask() == cases[index].mask);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x07] & 0x7FU) == due.second);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x08] & 0x7FU) == due.minute);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x09] & 0x3FU) == due.hour);
+            TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x0A] & 0x3FU) == due.date);
+        }
+    }
+}
+
+static void test_one_shot_retires(void)
+{
+    ds3231_job_t jobs[] = {
+        {.due = TEST_NOW, .period = 0U, .job_user = &fixture, .job_callback = test_callback},
+    };
+    test_setup(jobs, 1UL);
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+
+    TEST_ASSERT(fixture.callback_count == 1UL);
+    TEST_ASSERT(jobs[0].due == DS3231_JOB_DUE_NEVER);
+
+    // nothing left to wait for, both alarm interrupts are off
+    TEST_ASSERT((fixture.bus.regs[0x0E] & 0x03U) == 0U);
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.callback_count == 1UL);
+}
+
+static void test_nothing_due(void)
+{
+    ds3231_job_t jobs[] = {
+        {.due = TEST_NOW + 100, .period = 0U, .job_user = &fixture, .job_callback = test_callback},
+    };
+    test_setup(jobs, 1UL);
+
+    // no alarm flag raised, the handler must not touch the device beyond the status read
+    TEST_ASSERT(ds3231_scheduler_handle_alarm(&fixture.scheduler) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.callback_count == 0UL);
+    TEST_ASSERT(fixture.bus.write_count == 0UL);
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.callback_count == 0UL);
+    TEST_ASSERT(jobs[0].due == TEST_NOW + 100);
+
+    // a raised flag is cleared, but a job that is not due yet still does not run
+    fixture.bus.regs[0x0F] |= 0x01U;
+
+    TEST_ASSERT(ds3231_scheduler_handle_alarm(&fixture.scheduler) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.callback_count == 0UL);
+    TEST_ASSERT((fixture.bus.regs[0x0F] & 0x03U) == 0U);
+}
+
+static void test_slow_callback(void)
+{
+    ds3231_job_t jobs[] = {
+        {.due = TEST_NOW, .period = 5U, .job_user = &fixture, .job_callback = test_callback},
+    };
+    test_setup(jobs, 1UL);
+
+    fixture.advance = 10;
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+
+    // the alarm computed before the callback fell behind the clock, so the job ran again
+    TEST_ASSERT(fixture.callback_count == 2UL);
+    TEST_ASSERT(jobs[0].due == TEST_NOW + 15);
+
+    ds3231_time_t due = {};
+    TEST_ASSERT(ds3231_timestamp_to_time(
+                    jobs[0].due, ds3231_get_base_year(&fixture.ds3231), &due) == DS3231_ERR_OK);
+
+    TEST_ASSERT(fake_bus_bcd_to_bin(fixture.bus.regs[0x07] & 0x7FU) == due.second);
+    TEST_ASSERT(test_get_alarm1_mask() == DS3231_ALARM1_SEC_MATCH);
+}
+
+static void test_boot_keeps_armed_alarm(void)
+{
+    ds3231_job_t jobs[] = {
+        {.due = TEST_NOW + 30, .period = 0U},
+    };
+    test_setup(jobs, 1UL);
+
+    // power-on control and status
+    fixture.bus.regs[0x0E] = 0x1CU;
+    fixture.bus.regs[0x0F] = 0x08U;
+
+    TEST_ASSERT(ds3231_scheduler_run(&fixture.scheduler) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == 0x1EU);
+
+    // a watchdog reset before the alarm, the node boots again with its usual config
+    ds3231_config_t config = {.keep_alarm_enables = true};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&fixture.bus, &interface);
+
+    ds3231_time_t time = {};
+    ds3231_boot_t boot = {};
+    size_t write_count = fixture.bus.write_count;
+
+    TEST_ASSERT(ds3231_boot(&fixture.ds3231, &config, &interface, &time, &boot) == DS3231_ERR_OK);
+    TEST_ASSERT(boot == DS3231_BOOT_WARM);
+    TEST_ASSERT(fixture.bus.write_count == write_count);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == 0x1EU);
+
+    // another config change is applied around the armed alarm
+    config.bbsqw = true;
+
+    TEST_ASSERT(ds3231_boot(&fixture.ds3231, &config, &interface, &time, &boot) == DS3231_ERR_OK);
+    TEST_ASSERT(boot == DS3231_BOOT_RECONFIGURED);
+    TEST_ASSERT(fixture.bus.regs[0x0E] == 0x5EU);
+}
+
+int main(void)
+{
+    test_periodic_catch_up();
+    test_alarm_selection();
+    test_one_shot_retires();
+    test_nothing_due();
+    test_slow_callback();
+    test_boot_keeps_armed_alarm();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,203 @@
+#include "ds3231.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+// control and status as the device comes out of power-on reset
+#define TEST_CONTROL_POWER_ON 0x1CU
+#define TEST_STATUS_POWER_ON 0x88U
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_t ds3231;
+    ds3231_stats_t stats;
+    uint32_t ticks;
+    uint32_t latency;
+    size_t dump_count;
+    uint8_t dump_addresses[DS3231_STATS_ADDRESS_COUNT];
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static uint32_t test_get_ticks(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    return fixture.ticks;
+}
+
+// every read keeps the bus for latency ticks
+static void test_advance_ticks(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    fixture.ticks += fixture.latency;
+}
+
+static void test_dump(void* user, uint8_t address, ds3231_reg_stats_t const* reg_stats)
+{
+    TEST_ASSERT(user == &fixture);
+    TEST_ASSERT(reg_stats == &fixture.stats.reg_stats[address]);
+    TEST_ASSERT(fixture.dump_count < DS3231_STATS_ADDRESS_COUNT);
+
+    fixture.dump_addresses[fixture.dump_count++] = address;
+}
+
+static void test_setup(uint8_t retries)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    ds3231_time_t time = {.year = 23U, .month = 11U, .date = 14U, .day = 3U, .hour = 22U};
+    fake_bus_set_time(&fixture.bus, &time);
+
+    fixture.bus.regs[0x0E] = TEST_CONTROL_POWER_ON;
+    fixture.bus.regs[0x0F] = TEST_STATUS_POWER_ON;
+    fixture.bus.read_user = &fixture;
+    fixture.bus.read_callback = test_advance_ticks;
+
+    fixture.stats.tick_user = &fixture;
+    fixture.stats.get_ticks = test_get_ticks;
+
+    ds3231_config_t config = {.retries = retries, .stats = &fixture.stats};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&fixture.bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &interface) == DS3231_ERR_OK);
+}
+
+static void test_counts_per_address(void)
+{
+    test_setup(0U);
+
+    // the initialization burst from seconds up to the aging offset
+    ds3231_reg_stats_t const* seconds = &fixture.stats.reg_stats[0x00];
+
+    TEST_ASSERT(seconds->read_count == 1U && seconds->read_bytes == 17U);
+    TEST_ASSERT(seconds->write_count == 0U && seconds->write_bytes == 0U);
+
+    ds3231_time_t time = {};
+
+    TEST_ASSERT(ds3231_get_time_data(&fixture.ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_set_time_data(&fixture.ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(seconds->read_count == 2U && seconds->read_bytes == 24U);
+    TEST_ASSERT(seconds->write_count == 1U && seconds->write_bytes == 7U);
+
+    ds3231_control_reg_t control = {};
+
+    TEST_ASSERT(ds3231_get_control_reg(&fixture.ds3231, &control) == DS3231_ERR_OK);
+
+    ds3231_reg_stats_t const* control_stats = &fixture.stats.reg_stats[0x0E];
+
+    TEST_ASSERT(control_stats->read_count == 1U && control_stats->read_bytes == 1U);
+    TEST_ASSERT(control_stats->write_count == 0U);
+    TEST_ASSERT(seconds->error_count == 0U && control_stats->error_count == 0U);
+
+    // a burst is counted at the address it starts from only
+    ds3231_reg_stats_t zero = {};
+
+    TEST_ASSERT(memcmp(&fixture.stats.reg_stats[0x01], &zero, sizeof(zero)) == 0);
+    TEST_ASSERT(memcmp(&fixture.stats.reg_stats[0x0F], &zero, sizeof(zero)) == 0);
+}
+
+static void test_retries_counted(void)
+{
+    test_setup(2U);
+    ds3231_stats_reset(&fixture.stats);
+
+    ds3231_reg_stats_t const* seconds = &fixture.stats.reg_stats[0x00];
+    ds3231_time_t time = {};
+
+    // two lost attempts and the third gets through, each one counted
+    fixture.bus.fail_count = 2UL;
+
+    TEST_ASSERT(ds3231_get_time_data(&fixture.ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(seconds->read_count == 3U && seconds->read_bytes == 21U);
+    TEST_ASSERT(seconds->error_count == 2U);
+
+    // every attempt lost
+    fixture.bus.fail_count = 3UL;
+
+    TEST_ASSERT(ds3231_get_time_data(&fixture.ds3231, &time) == DS3231_ERR_FAIL);
+    TEST_ASSERT(seconds->read_count == 6U && seconds->error_count == 5U);
+
+    time = (ds3231_time_t){0U, 23U, 11U, 14U, 3U, 22U, 0U, 0U};
+    fixture.bus.fail_count = 1UL;
+
+    TEST_ASSERT(ds3231_set_time_data(&fixture.ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(seconds->write_count == 2U && seconds->write_bytes == 14U);
+    TEST_ASSERT(seconds->error_count == 6U);
+}
+
+static void test_expect_bucket(uint32_t latency, size_t bucket)
+{
+    ds3231_stats_reset(&fixture.stats);
+    fixture.latency = latency;
+
+    ds3231_control_reg_t control = {};
+
+    TEST_ASSERT(ds3231_get_control_reg(&fixture.ds3231, &control) == DS3231_ERR_OK);
+
+    uint32_t const* histogram = fixture.stats.reg_stats[0x0E].latency_histogram;
+
+    for (size_t index = 0UL; index < DS3231_STATS_LATENCY_BUCKETS; ++index) {
+        TEST_ASSERT(histogram[index] == (index == bucket ? 1U : 0U));
+    }
+}
+
+static void test_latency_buckets(void)
+{
+    test_setup(0U);
+
+    // bucket n holds latencies of bit width n, from 2^14 on everything lands in the last one
+    test_expect_bucket(0U, 0UL);
+    test_expect_bucket(1U, 1UL);
+    test_expect_bucket(2U, 2UL);
+    test_expect_bucket((1U << 14U) - 1U, 14UL);
+    test_expect_bucket(1U << 14U, DS3231_STATS_LATENCY_BUCKETS - 1UL);
+    test_expect_bucket(UINT32_MAX, DS3231_STATS_LATENCY_BUCKETS - 1UL);
+
+    // the tick counter wrapping during a transfer still gives the latency
+    fixture.ticks = UINT32_MAX;
+    test_expect_bucket(3U, 2UL);
+}
+
+static void test_reset_and_dump(void)
+{
+    test_setup(0U);
+
+    ds3231_control_reg_t control = {};
+
+    TEST_ASSERT(ds3231_get_control_reg(&fixture.ds3231, &control) == DS3231_ERR_OK);
+
+    // only the addresses that saw traffic are dumped, in address order
+    ds3231_stats_dump(&fixture.stats, test_dump, &fixture);
+
+    TEST_ASSERT(fixture.dump_count == 2UL);
+    TEST_ASSERT(fixture.dump_addresses[0] == 0x00U && fixture.dump_addresses[1] == 0x0EU);
+
+    ds3231_stats_reset(&fixture.stats);
+
+    ds3231_reg_stats_t zero = {};
+
+    for (size_t address = 0UL; address < DS3231_STATS_ADDRESS_COUNT; ++address) {
+        TEST_ASSERT(memcmp(&fixture.stats.reg_stats[address], &zero, sizeof(zero)) == 0);
+    }
+
+    // the tick source survives the reset
+    TEST_ASSERT(fixture.stats.get_ticks == test_get_ticks);
+
+    fixture.dump_count = 0UL;
+    ds3231_stats_dump(&fixture.stats, test_dump, &fixture);
+
+    TEST_ASSERT(fixture.dump_count == 0UL);
+}
+
+int main(void)
+{
+    test_counts_per_address();
+    test_retries_counted();
+    test_latency_buckets();
+    test_reset_and_dump();
+
+    return EXIT_SUCCESS;
+}
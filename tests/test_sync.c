@@ -0,0 +1,220 @@
+#include "ds3231_sync.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+// 2023-11-14 22:13:30
+#define TEST_REFERENCE 1700000010LL
+
+// a device whose seconds follow the tick source from the moment the time write lands
+typedef struct {
+    fake_bus_t bus;
+    ds3231_interface_t bus_interface;
+    ds3231_t ds3231;
+    ds3231_sync_t sync;
+    uint32_t tick_frequency;
+    uint32_t write_latency;
+    uint32_t ticks;
+    uint32_t tick_step;
+    bool is_latched;
+    uint32_t latch_ticks;
+    int64_t latch_timestamp;
+    int64_t drift;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static uint32_t test_get_ticks(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    fixture.ticks += fixture.tick_step;
+
+    return fixture.ticks;
+}
+
+static ds3231_err_t test_bus_initialize(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    return fixture.bus_interface.bus_initialize(fixture.bus_interface.bus_user);
+}
+
+static ds3231_err_t test_bus_deinitialize(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    return fixture.bus_interface.bus_deinitialize(fixture.bus_interface.bus_user);
+}
+
+// a time burst takes the bus for write_latency and takes effect once it completes
+static ds3231_err_t test_bus_write_data(void* user,
+                                        uint8_t write_address,
+                                        uint8_t const* write_data,
+                                        size_t write_size)
+{
+    TEST_ASSERT(user == &fixture);
+
+    if (write_address == 0x00U && write_size >= DS3231_REG_ADDR_YEAR + 1UL) {
+        ds3231_time_t time = {};
+        ds3231_time_data_to_time(write_data, &time);
+
+        fixture.ticks += fixture.write_latency;
+        fixture.is_latched = true;
+        fixture.latch_ticks = fixture.ticks;
+        fixture.latch_timestamp =
+            ds3231_time_to_timestamp(&time, ds3231_get_base_year(&fixture.ds3231));
+    }
+
+    return fixture.bus_interface.bus_write_data(fixture.bus_interface.bus_user,
+                                                write_address,
+                                                write_data,
+                                                write_size);
+}
+
+static ds3231_err_t test_bus_read_data(void* user,
+                                       uint8_t read_address,
+                                       uint8_t* read_data,
+                                       size_t read_size)
+{
+    TEST_ASSERT(user == &fixture);
+
+    if (fixture.is_latched) {
+        uint32_t elapsed = fixture.ticks - fixture.latch_ticks;
+        int64_t seconds = (int64_t)(elapsed / fixture.tick_frequency);
+
+        ds3231_time_t time = {};
+        TEST_ASSERT(ds3231_timestamp_to_time(fixture.latch_timestamp + seconds + fixture.drift,
+                                             ds3231_get_base_year(&fixture.ds3231),
+                                             &time) == DS3231_ERR_OK);
+
+        fake_bus_set_time(&fixture.bus, &time);
+    }
+
+    return fixture.bus_interface.bus_read_data(fixture.bus_interface.bus_user,
+                                               read_address,
+                                               read_data,
+                                               read_size);
+}
+
+static void test_setup(uint32_t tick_frequency, uint32_t write_latency, uint32_t tick_step)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    fixture.tick_frequency = tick_frequency;
+    fixture.write_latency = write_latency;
+    fixture.tick_step = tick_step;
+
+    fake_bus_get_interface(&fixture.bus, &fixture.bus_interface);
+
+    ds3231_config_t config = {};
+    ds3231_interface_t interface = {
+        .bus_user = &fixture,
+        .bus_initialize = test_bus_initialize,
+        .bus_deinitialize = test_bus_deinitialize,
+        .bus_write_data = test_bus_write_data,
+        .bus_read_data = test_bus_read_data,
+    };
+
+    TEST_ASSERT(ds3231_initialize(&fixture.ds3231, &config, &interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_sync_initialize(&fixture.sync,
+                                       &fixture.ds3231,
+                                       &fixture,
+                                       test_get_ticks,
+                                       tick_frequency,
+                                       write_latency) == DS3231_ERR_OK);
+}
+
+// ticks at which the reference clock reaches the given whole second
+static uint32_t test_boundary_ticks(ds3231_sync_reference_t const* reference, int64_t timestamp)
+{
+    uint64_t microseconds =
+        (uint64_t)(timestamp - reference->timestamp) * 1000000ULL - reference->microseconds;
+
+    return reference->ticks + (uint32_t)(microseconds * fixture.tick_frequency / 1000000ULL);
+}
+
+static void test_write_lands_on_boundary(void)
+{
+    test_setup(1000000U, 2000U, 1U);
+
+    ds3231_sync_reference_t reference = {TEST_REFERENCE, 200000U, 0U};
+    fixture.ticks = 1000U;
+
+    ds3231_sync_result_t result = {};
+
+    TEST_ASSERT(ds3231_sync_time(&fixture.sync, &reference, &result) == DS3231_ERR_OK);
+    TEST_ASSERT(result.timestamp == TEST_REFERENCE + 1);
+
+    uint32_t boundary = test_boundary_ticks(&reference, result.timestamp);
+
+    // the write lands on the boundary, at most one tick late, and phase_error says by how much
+    TEST_ASSERT(fixture.is_latched);
+    TEST_ASSERT(fixture.latch_ticks - boundary <= fixture.tick_step);
+    TEST_ASSERT((uint32_t)result.phase_error == fixture.latch_ticks - boundary);
+    TEST_ASSERT(result.residual_seconds == 0);
+}
+
+static void test_missed_deadline_skips_second(void)
+{
+    test_setup(1000000U, 2000U, 1U);
+
+    // too close to the next boundary to start the write in time
+    ds3231_sync_reference_t reference = {TEST_REFERENCE, 999000U, 0U};
+    fixture.ticks = 500U;
+
+    ds3231_sync_result_t result = {};
+
+    TEST_ASSERT(ds3231_sync_time(&fixture.sync, &reference, &result) == DS3231_ERR_OK);
+    TEST_ASSERT(result.timestamp == TEST_REFERENCE + 2);
+
+    uint32_t boundary = test_boundary_ticks(&reference, result.timestamp);
+
+    TEST_ASSERT(fixture.latch_ticks - boundary <= fixture.tick_step);
+    TEST_ASSERT(result.residual_seconds == 0);
+}
+
+static void test_coarse_ticks_report_phase_error(void)
+{
+    // a 32768 Hz source read every 7 ticks overshoots the deadline by up to six ticks
+    test_setup(32768U, 66U, 7U);
+
+    ds3231_sync_reference_t reference = {TEST_REFERENCE, 0U, 100U};
+    fixture.ticks = 100U;
+
+    ds3231_sync_result_t result = {};
+
+    TEST_ASSERT(ds3231_sync_time(&fixture.sync, &reference, &result) == DS3231_ERR_OK);
+    TEST_ASSERT(result.timestamp == TEST_REFERENCE + 1);
+
+    uint32_t late = fixture.latch_ticks - test_boundary_ticks(&reference, result.timestamp);
+
+    TEST_ASSERT(late < fixture.tick_step);
+    TEST_ASSERT(result.phase_error >= 0);
+    TEST_ASSERT((uint32_t)result.phase_error == late * 1000000U / fixture.tick_frequency);
+    TEST_ASSERT(result.residual_seconds == 0);
+}
+
+static void test_residual_seconds_reported(void)
+{
+    test_setup(1000000U, 2000U, 1U);
+
+    // a device that runs a second ahead of what was written
+    fixture.drift = 1;
+
+    ds3231_sync_reference_t reference = {TEST_REFERENCE, 200000U, 0U};
+    ds3231_sync_result_t result = {};
+
+    TEST_ASSERT(ds3231_sync_time(&fixture.sync, &reference, &result) == DS3231_ERR_OK);
+    TEST_ASSERT(result.residual_seconds == 1);
+}
+
+int main(void)
+{
+    test_write_lands_on_boundary();
+    test_missed_deadline_skips_second();
+    test_coarse_ticks_report_phase_error();
+    test_residual_seconds_reported();
+
+    return EXIT_SUCCESS;
+}
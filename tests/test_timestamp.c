@@ -0,0 +1,157 @@
+#include "ds3231.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+static void test_expect_time(int64_t timestamp, uint16_t base_year, ds3231_time_t const* expected)
+{
+    ds3231_time_t time = {};
+    TEST_ASSERT(ds3231_timestamp_to_time(timestamp, base_year, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(memcmp(&time, expected, sizeof(time)) == 0);
+    TEST_ASSERT(ds3231_time_to_timestamp(expected, base_year) == timestamp);
+}
+
+static void test_known_dates(void)
+{
+    // 2023-11-14 22:13:30, a tuesday
+    ds3231_time_t time = {0U, 23U, 11U, 14U, 2U, 22U, 13U, 30U};
+    test_expect_time(1700000010LL, 2000U, &time);
+
+    // the same instant seen from a 1900 base lands in the second century
+    time.century = 1U;
+    test_expect_time(1700000010LL, 1900U, &time);
+
+    // one second before the epoch, a wednesday
+    time = (ds3231_time_t){0U, 69U, 12U, 31U, 3U, 23U, 59U, 59U};
+    test_expect_time(-1LL, 1900U, &time);
+
+    // 1900 is not a leap year
+    time = (ds3231_time_t){0U, 0U, 3U, 1U, 4U, 0U, 0U, 0U};
+    test_expect_time(-2203891200LL, 1900U, &time);
+
+    // 2100 is not a leap year either
+    time = (ds3231_time_t){1U, 0U, 3U, 1U, 1U, 0U, 0U, 0U};
+    test_expect_time(4107542400LL, 2000U, &time);
+}
+
+static void test_round_trip(uint16_t base_year)
+{
+    ds3231_time_t first = {0U, 0U, 1U, 1U, 1U, 0U, 0U, 0U};
+    ds3231_time_t last = {1U, 99U, 12U, 31U, 1U, 23U, 59U, 59U};
+
+    int64_t begin = ds3231_time_to_timestamp(&first, base_year);
+    int64_t end = ds3231_time_to_timestamp(&last, base_year);
+
+    // a little under a day per step, so every hour of the day and every date comes up
+    for (int64_t timestamp = begin; timestamp <= end; timestamp += 86399) {
+        ds3231_time_t time = {};
+        TEST_ASSERT(ds3231_timestamp_to_time(timestamp, base_year, &time) == DS3231_ERR_OK);
+
+        TEST_ASSERT(time.century <= 1U && time.year <= 99U);
+        TEST_ASSERT(ds3231_time_to_timestamp(&time, base_year) == timestamp);
+    }
+}
+
+static void test_outside_window_fails(void)
+{
+    ds3231_time_t time = {.month = 5U};
+
+    // one second either side of the two centuries the device counts
+    TEST_ASSERT(ds3231_timestamp_to_time(-2208988801LL, 1900U, &time) == DS3231_ERR_FAIL);
+    TEST_ASSERT(ds3231_timestamp_to_time(4102444800LL, 1900U, &time) == DS3231_ERR_FAIL);
+    TEST_ASSERT(time.month == 5U);
+
+    TEST_ASSERT(ds3231_timestamp_to_time(-2208988800LL, 1900U, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_timestamp_to_time(4102444799LL, 1900U, &time) == DS3231_ERR_OK);
+}
+
+static void test_base_year_from_config(void)
+{
+    ds3231_t ds3231 = {};
+
+    TEST_ASSERT(ds3231_get_base_year(&ds3231) == DS3231_BASE_CENTURY_DEFAULT * 100U);
+
+    ds3231.config.base_century = 19U;
+
+    TEST_ASSERT(ds3231_get_base_year(&ds3231) == 1900U);
+}
+
+static void test_device_feb_29_2100(void)
+{
+    fake_bus_t bus = {};
+    ds3231_t ds3231 = {};
+    ds3231_config_t config = {};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+
+    // a leap day the device counted on its own in 2000 is left alone
+    ds3231_time_t time = {0U, 0U, 2U, 29U, 2U, 10U, 0U, 0U};
+    fake_bus_set_time(&bus, &time);
+    bus.write_count = 0UL;
+
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(time.month == 2U && time.date == 29U);
+    TEST_ASSERT(bus.write_count == 0UL);
+
+    // in 2100 the same day is mar 1, on the device as well
+    time = (ds3231_time_t){1U, 0U, 2U, 29U, 1U, 10U, 0U, 0U};
+    fake_bus_set_time(&bus, &time);
+
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(time.month == 3U && time.date == 1U && time.hour == 10U);
+    TEST_ASSERT(ds3231_time_to_timestamp(&time, 2000U) == 4107542400LL + 36000LL);
+    TEST_ASSERT(bus.write_count == 1UL);
+    TEST_ASSERT(bus.regs[0x04] == 0x01U);
+    TEST_ASSERT(bus.regs[0x05] == 0x83U);
+    TEST_ASSERT(bus.regs[0x02] == 0x10U);
+
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(time.month == 3U && time.date == 1U);
+    TEST_ASSERT(bus.write_count == 1UL);
+}
+
+static void test_full_year_keeps_date_valid(void)
+{
+    fake_bus_t bus = {};
+    ds3231_t ds3231 = {};
+    ds3231_config_t config = {};
+    ds3231_interface_t interface = {};
+    fake_bus_get_interface(&bus, &interface);
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+
+    ds3231_time_t time = {0U, 24U, 2U, 29U, 4U, 10U, 0U, 0U};
+    fake_bus_set_time(&bus, &time);
+    bus.write_count = 0UL;
+
+    // feb 29 does not exist in 2023 or 2100
+    TEST_ASSERT(ds3231_set_full_year_data(&ds3231, 2023U) == DS3231_ERR_FAIL);
+    TEST_ASSERT(ds3231_set_full_year_data(&ds3231, 2100U) == DS3231_ERR_FAIL);
+    TEST_ASSERT(bus.write_count == 0UL);
+    TEST_ASSERT(bus.regs[0x06] == 0x24U);
+
+    uint16_t year = 0U;
+
+    TEST_ASSERT(ds3231_set_full_year_data(&ds3231, 2128U) == DS3231_ERR_OK);
+    TEST_ASSERT(bus.write_count == 1UL);
+    TEST_ASSERT(bus.regs[0x05] == 0x82U && bus.regs[0x06] == 0x28U);
+    TEST_ASSERT(bus.regs[0x04] == 0x29U);
+    TEST_ASSERT(ds3231_get_full_year_data(&ds3231, &year) == DS3231_ERR_OK);
+    TEST_ASSERT(year == 2128U);
+}
+
+int main(void)
+{
+    test_known_dates();
+    test_round_trip(1900U);
+    test_round_trip(2000U);
+    test_round_trip(2100U);
+    test_outside_window_fails();
+    test_base_year_from_config();
+    test_device_feb_29_2100();
+    test_full_year_keeps_date_valid();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,315 @@
+#include "ds3231.h"
+#include "ds3231_trace.h"
+#include "fake_bus.h"
+#include "test_utility.h"
+#include <string.h>
+
+// room for one time burst and a little more
+#define TEST_BUFFER_SIZE (2UL * DS3231_TRACE_RECORD_HEADER_SIZE + 10UL)
+
+// room for a whole driver session
+#define TEST_SESSION_SIZE 256UL
+#define TEST_SESSION_RECORDS 8UL
+
+// control and status as the device comes out of power-on reset
+#define TEST_CONTROL_POWER_ON 0x1CU
+#define TEST_STATUS_POWER_ON 0x88U
+
+#define TEST_TICK_STEP 37U
+
+typedef struct {
+    fake_bus_t bus;
+    ds3231_trace_recorder_t recorder;
+    uint8_t buffer[TEST_SESSION_SIZE];
+    uint32_t ticks;
+} test_fixture_t;
+
+static test_fixture_t fixture;
+
+static uint32_t test_get_ticks(void* user)
+{
+    TEST_ASSERT(user == &fixture);
+
+    fixture.ticks += TEST_TICK_STEP;
+
+    return fixture.ticks;
+}
+
+static void test_setup(ds3231_interface_t* interface, size_t buffer_size)
+{
+    memset(&fixture, 0, sizeof(fixture));
+
+    fake_bus_get_interface(&fixture.bus, &fixture.recorder.interface);
+
+    ds3231_time_t time = {.year = 24U, .month = 2U, .date = 29U, .day = 4U, .hour = 21U};
+    fake_bus_set_time(&fixture.bus, &time);
+
+    fixture.bus.regs[0x0E] = TEST_CONTROL_POWER_ON;
+    fixture.bus.regs[0x0F] = TEST_STATUS_POWER_ON;
+
+    fixture.recorder.tick_user = &fixture;
+    fixture.recorder.get_ticks = test_get_ticks;
+    fixture.recorder.buffer = fixture.buffer;
+    fixture.recorder.buffer_size = buffer_size;
+
+    ds3231_trace_recorder_get_interface(&fixture.recorder, interface);
+}
+
+static void test_replay_setup(ds3231_trace_replay_t* replay, ds3231_interface_t* interface)
+{
+    *replay = (ds3231_trace_replay_t){
+        .buffer = fixture.buffer,
+        .buffer_length = fixture.recorder.buffer_length,
+    };
+
+    ds3231_trace_replay_get_interface(replay, interface);
+}
+
+static void test_overflow_stops_recording(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_BUFFER_SIZE);
+
+    uint8_t data[15] = {};
+
+    TEST_ASSERT(interface.bus_read_data(interface.bus_user, 0x00U, data, 7UL) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.recorder.buffer_length == DS3231_TRACE_RECORD_HEADER_SIZE + 7UL);
+    TEST_ASSERT(!fixture.recorder.is_overflow);
+
+    TEST_ASSERT(interface.bus_read_data(interface.bus_user, 0x02U, data, 15UL) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.recorder.is_overflow);
+
+    // would still fit, but the trace must not continue past the dropped record
+    TEST_ASSERT(interface.bus_write_data(interface.bus_user, 0x0EU, data, 1UL) ==
+                DS3231_ERR_OK);
+    TEST_ASSERT(fixture.recorder.buffer_length == DS3231_TRACE_RECORD_HEADER_SIZE + 7UL);
+
+    // the bus itself is still driven
+    TEST_ASSERT(fixture.bus.read_count == 2UL);
+    TEST_ASSERT(fixture.bus.write_count == 1UL);
+}
+
+static void test_replay_round_trip(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_BUFFER_SIZE);
+
+    uint8_t recorded[7] = {};
+    TEST_ASSERT(interface.bus_read_data(interface.bus_user, 0x00U, recorded, sizeof(recorded)) ==
+                DS3231_ERR_OK);
+
+    ds3231_trace_replay_t replay = {
+        .buffer = fixture.buffer,
+        .buffer_length = fixture.recorder.buffer_length,
+    };
+    ds3231_interface_t replay_interface = {};
+    ds3231_trace_replay_get_interface(&replay, &replay_interface);
+
+    uint8_t replayed[7] = {};
+    TEST_ASSERT(replay_interface.bus_read_data(replay_interface.bus_user,
+                                               0x00U,
+                                               replayed,
+                                               sizeof(replayed)) == DS3231_ERR_OK);
+    TEST_ASSERT(memcmp(recorded, replayed, sizeof(recorded)) == 0);
+
+    // the trace is exhausted
+    TEST_ASSERT(replay_interface.bus_read_data(replay_interface.bus_user,
+                                               0x00U,
+                                               replayed,
+                                               sizeof(replayed)) != DS3231_ERR_OK);
+}
+
+static void test_replay_session(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_SESSION_SIZE);
+
+    // the 12 hour mode makes initialize write the hours back as well as read them
+    ds3231_config_t config = {.sys_12_n24 = true};
+    ds3231_t ds3231 = {};
+    ds3231_time_t recorded = {};
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &recorded) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.bus.write_count >= 1UL);
+    TEST_ASSERT(!fixture.recorder.is_overflow);
+
+    // the same session against the trace, with no device behind it
+    ds3231_trace_replay_t replay = {};
+    ds3231_interface_t replay_interface = {};
+    test_replay_setup(&replay, &replay_interface);
+    replay.verify_writes = true;
+
+    ds3231_t replay_ds3231 = {};
+    ds3231_time_t replayed = {};
+
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_get_time_data(&replay_ds3231, &replayed) == DS3231_ERR_OK);
+    TEST_ASSERT(memcmp(&recorded, &replayed, sizeof(recorded)) == 0);
+    TEST_ASSERT(replayed.hour == 21U);
+    TEST_ASSERT(replay.buffer_position == replay.buffer_length);
+}
+
+static void test_replay_ticks(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_SESSION_SIZE);
+
+    ds3231_config_t config = {.sys_12_n24 = true};
+    ds3231_t ds3231 = {};
+    ds3231_time_t time = {};
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &time) == DS3231_ERR_OK);
+
+    ds3231_trace_replay_t replay = {};
+    ds3231_interface_t replay_interface = {};
+    test_replay_setup(&replay, &replay_interface);
+
+    // walk the trace record by record, the ticks follow the recorder's source one step apart
+    size_t records = 0UL;
+    uint8_t data[UINT8_MAX] = {};
+
+    while (replay.buffer_position < replay.buffer_length) {
+        uint8_t const* record = &replay.buffer[replay.buffer_position];
+        ds3231_err_t err = DS3231_ERR_OK;
+
+        if (record[0] & DS3231_TRACE_FLAG_WRITE) {
+            err = replay_interface.bus_write_data(replay_interface.bus_user,
+                                                  record[1],
+                                                  &record[DS3231_TRACE_RECORD_HEADER_SIZE],
+                                                  record[2]);
+        } else {
+            err = replay_interface.bus_read_data(replay_interface.bus_user,
+                                                 record[1],
+                                                 data,
+                                                 record[2]);
+        }
+
+        records++;
+
+        TEST_ASSERT(err == DS3231_ERR_OK);
+        TEST_ASSERT(ds3231_trace_replay_get_ticks(&replay) == (uint32_t)records * TEST_TICK_STEP);
+        TEST_ASSERT(records < TEST_SESSION_RECORDS);
+    }
+
+    TEST_ASSERT(records >= 3UL);
+}
+
+static void test_replay_mismatch_keeps_record(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_SESSION_SIZE);
+
+    uint8_t data[7] = {};
+
+    TEST_ASSERT(interface.bus_read_data(interface.bus_user, 0x00U, data, sizeof(data)) ==
+                DS3231_ERR_OK);
+
+    ds3231_trace_replay_t replay = {};
+    ds3231_interface_t replay_interface = {};
+    test_replay_setup(&replay, &replay_interface);
+
+    // wrong direction, wrong address, wrong length
+    TEST_ASSERT(replay_interface.bus_write_data(
+                    replay_interface.bus_user, 0x00U, data, sizeof(data)) == DS3231_ERR_FAIL);
+    TEST_ASSERT(replay.buffer_position == 0UL);
+    TEST_ASSERT(replay_interface.bus_read_data(
+                    replay_interface.bus_user, 0x01U, data, sizeof(data)) == DS3231_ERR_FAIL);
+    TEST_ASSERT(replay.buffer_position == 0UL);
+    TEST_ASSERT(replay_interface.bus_read_data(
+                    replay_interface.bus_user, 0x00U, data, sizeof(data) - 1UL) ==
+                DS3231_ERR_FAIL);
+    TEST_ASSERT(replay.buffer_position == 0UL);
+
+    // the record is still there for the transfer that matches it
+    TEST_ASSERT(replay_interface.bus_read_data(
+                    replay_interface.bus_user, 0x00U, data, sizeof(data)) == DS3231_ERR_OK);
+    TEST_ASSERT(replay.buffer_position == DS3231_TRACE_RECORD_HEADER_SIZE + sizeof(data));
+}
+
+static void test_replay_reproduces_error(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_SESSION_SIZE);
+
+    // the first read is lost on the bus and retried
+    ds3231_config_t config = {.retries = 1U};
+    ds3231_t ds3231 = {};
+    ds3231_time_t time = {};
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+
+    size_t session_start = fixture.recorder.buffer_length;
+    fixture.bus.fail_count = 1UL;
+
+    TEST_ASSERT(ds3231_get_time_data(&ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(fixture.buffer[session_start] == DS3231_TRACE_FLAG_ERROR);
+
+    // the replay loses the same read, a driver that retries gets through it
+    ds3231_trace_replay_t replay = {};
+    ds3231_interface_t replay_interface = {};
+    test_replay_setup(&replay, &replay_interface);
+
+    ds3231_t replay_ds3231 = {};
+    ds3231_time_t replayed = {};
+
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_get_time_data(&replay_ds3231, &replayed) == DS3231_ERR_OK);
+    TEST_ASSERT(memcmp(&time, &replayed, sizeof(time)) == 0);
+    TEST_ASSERT(replay.buffer_position == replay.buffer_length);
+
+    // and one that does not sees the error
+    config.retries = 0U;
+
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_get_time_data(&replay_ds3231, &replayed) == DS3231_ERR_FAIL);
+}
+
+static void test_replay_verifies_writes(void)
+{
+    ds3231_interface_t interface = {};
+    test_setup(&interface, TEST_SESSION_SIZE);
+
+    ds3231_config_t config = {};
+    ds3231_t ds3231 = {};
+    ds3231_time_t time = {.year = 24U, .month = 3U, .date = 1U, .day = 5U, .hour = 8U};
+
+    TEST_ASSERT(ds3231_initialize(&ds3231, &config, &interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_set_time_data(&ds3231, &time) == DS3231_ERR_OK);
+
+    ds3231_trace_replay_t replay = {};
+    ds3231_interface_t replay_interface = {};
+    test_replay_setup(&replay, &replay_interface);
+
+    ds3231_t replay_ds3231 = {};
+    ds3231_time_t changed = time;
+    changed.minute = 1U;
+
+    // without verification only the shape of the write is checked
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_set_time_data(&replay_ds3231, &changed) == DS3231_ERR_OK);
+
+    replay.verify_writes = true;
+
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_set_time_data(&replay_ds3231, &changed) == DS3231_ERR_FAIL);
+
+    TEST_ASSERT(ds3231_initialize(&replay_ds3231, &config, &replay_interface) == DS3231_ERR_OK);
+    TEST_ASSERT(ds3231_set_time_data(&replay_ds3231, &time) == DS3231_ERR_OK);
+    TEST_ASSERT(replay.buffer_position == replay.buffer_length);
+}
+
+int main(void)
+{
+    test_overflow_stops_recording();
+    test_replay_round_trip();
+    test_replay_session();
+    test_replay_ticks();
+    test_replay_mismatch_keeps_record();
+    test_replay_reproduces_error();
+    test_replay_verifies_writes();
+
+    return EXIT_SUCCESS;
+}
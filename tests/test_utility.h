@@ -0,0 +1,15 @@
+#ifndef DS3231_TESTS_TEST_UTILITY_H
+#define DS3231_TESTS_TEST_UTILITY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ASSERT(condition)                                                     \
+    do {                                                                           \
+        if (!(condition)) {                                                        \
+            fprintf(stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #condition); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (0)
+
+#endif // DS3231_TESTS_TEST_UTILITY_H